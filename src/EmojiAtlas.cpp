@@ -0,0 +1,364 @@
+#include "EmojiAtlas.hpp"
+#include "EmojiPickerSettings.hpp"
+#include "emoji-atlas.hpp"
+#include "emojis.hpp"
+#include <QDir>
+#include <QFile>
+#include <QImage>
+#include <QResource>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QThreadPool>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// the decoded pages of one cell size are written to the cache directory once and memory mapped by every later process.
+// layout: header, padding up to `emojiAtlasCacheAlignment`, then every page as premultiplied ARGB32
+struct EmojiAtlasCacheHeader {
+  char magic[8];
+  quint32 hash;
+  quint32 cellSize;
+  quint32 pageCount;
+  quint32 pageBytes;
+};
+
+const char emojiAtlasCacheMagic[8] = {'E', 'M', 'J', 'A', 'T', 'L', 'S', '1'};
+
+// pages start at a multiple of this so their scanlines stay aligned in the mapping
+constexpr qint64 emojiAtlasCacheAlignment = 64;
+
+struct EmojiAtlasPages {
+  // keeps the mapping alive, null while the pages are decoded
+  std::unique_ptr<QFile> file;
+  std::vector<QImage> pages;
+
+  // only used while the pages are decoded
+  std::vector<bool> queued;
+  int decodedLength = 0;
+  bool decodingAll = false;
+};
+
+// guards `emojiAtlasPages`, the pages are decoded by `emojiAtlasDecoders`
+static std::mutex emojiAtlasMutex;
+static std::map<int, EmojiAtlasPages> emojiAtlasPages;
+
+// the decoded page is drawn, before the pages that are only prefetched, before the rest of the pages.
+// the rest is only decoded so the cache can be written, which needs every page
+constexpr int emojiAtlasDrawPriority = 1;
+constexpr int emojiAtlasPrefetchPriority = 0;
+constexpr int emojiAtlasBackgroundPriority = -1;
+
+EmojiAtlasNotifier* getEmojiAtlasNotifier() {
+  static EmojiAtlasNotifier notifier;
+  return &notifier;
+}
+
+QThreadPool* getEmojiAtlasDecoders() {
+  static QThreadPool* decoders = []() {
+    auto decoders = new QThreadPool();
+    decoders->setMaxThreadCount(2);
+    return decoders;
+  }();
+
+  return decoders;
+}
+
+// the smallest cell that does not have to be scaled up
+int getEmojiAtlasCellSize(int devicePixels) {
+  for (int cellSize : emojiAtlasCellSizes) {
+    if (cellSize >= devicePixels) {
+      return cellSize;
+    }
+  }
+
+  return emojiAtlasCellSizes[sizeof(emojiAtlasCellSizes) / sizeof(int) - 1];
+}
+
+QString getEmojiAtlasPagePath(int cellSize, int pageId) {
+  return QString(":/emoji-atlas/%1-%2.png").arg(cellSize).arg(pageId);
+}
+
+QString getEmojiAtlasCachePath(int cellSize) {
+  return EmojiPickerCache::directory() + QString("/emoji-atlas-%1.cache").arg(cellSize);
+}
+
+// the pages are shipped as emoji-atlas.rcc instead of being compiled in.
+// it is only registered when a page has to be decoded, a process that maps the cache never loads it
+bool registerEmojiAtlasResource() {
+  // called by the decoders, the static initialization keeps it to one thread
+  static bool registered = []() {
+    for (const QString& path : QString(EMOJI_ATLAS_RESOURCE_PATHS).split(':')) {
+      if (QFile::exists(path) && QResource::registerResource(path)) {
+        return true;
+      }
+    }
+
+    return false;
+  }();
+
+  return registered;
+}
+
+QImage readEmojiAtlasPage(int cellSize, int pageId) {
+  if (!registerEmojiAtlasResource()) {
+    return QImage{};
+  }
+
+  return QImage{getEmojiAtlasPagePath(cellSize, pageId), "PNG"}.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+}
+
+bool mapEmojiAtlasCache(int cellSize, EmojiAtlasPages& atlas) {
+  int pageWidth = emojiAtlasPageColumns * cellSize;
+  int pageHeight = emojiAtlasPageRows * cellSize;
+  qint64 pageBytes = (qint64)pageWidth * pageHeight * 4;
+
+  auto file = std::make_unique<QFile>(getEmojiAtlasCachePath(cellSize));
+  if (!file->open(QFile::ReadOnly) || file->size() != emojiAtlasCacheAlignment + pageBytes * emojiAtlasPageCount) {
+    return false;
+  }
+
+  const uchar* data = file->map(0, file->size());
+  if (!data) {
+    return false;
+  }
+
+  EmojiAtlasCacheHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  if (std::memcmp(header.magic, emojiAtlasCacheMagic, sizeof(header.magic)) != 0 || header.hash != emojiAtlasHash || header.cellSize != (quint32)cellSize || header.pageCount != (quint32)emojiAtlasPageCount || header.pageBytes != pageBytes) {
+    return false;
+  }
+
+  // the images only reference the mapping, nothing is copied
+  for (int pageId = 0; pageId < emojiAtlasPageCount; pageId++) {
+    atlas.pages.emplace_back(data + emojiAtlasCacheAlignment + pageId * pageBytes, pageWidth, pageHeight, pageWidth * 4, QImage::Format_ARGB32_Premultiplied);
+  }
+  atlas.file = std::move(file);
+
+  return true;
+}
+
+bool writeEmojiAtlasCache(int cellSize, const std::vector<QImage>& pages) {
+  int pageWidth = emojiAtlasPageColumns * cellSize;
+  int pageHeight = emojiAtlasPageRows * cellSize;
+  qint64 pageBytes = (qint64)pageWidth * pageHeight * 4;
+
+  QDir{}.mkpath(EmojiPickerCache::directory());
+
+  // written to a temporary file first so no process ever maps a half written cache
+  QSaveFile file{getEmojiAtlasCachePath(cellSize)};
+  if (!file.open(QFile::WriteOnly)) {
+    return false;
+  }
+
+  EmojiAtlasCacheHeader header;
+  std::memcpy(header.magic, emojiAtlasCacheMagic, sizeof(header.magic));
+  header.hash = emojiAtlasHash;
+  header.cellSize = cellSize;
+  header.pageCount = emojiAtlasPageCount;
+  header.pageBytes = pageBytes;
+
+  QByteArray headerBlock(emojiAtlasCacheAlignment, '\0');
+  std::memcpy(headerBlock.data(), &header, sizeof(header));
+  file.write(headerBlock);
+
+  for (const QImage& page : pages) {
+    if (page.width() != pageWidth || page.height() != pageHeight || page.bytesPerLine() != pageWidth * 4) {
+      file.cancelWriting();
+      return false;
+    }
+
+    file.write((const char*)page.constBits(), pageBytes);
+  }
+
+  return file.commit();
+}
+
+void queueEmojiAtlasPage(int cellSize, int pageId, int priority);
+
+// `decodeAll` is only set for pages decoded for the grid, the picker is not shown yet otherwise
+void storeEmojiAtlasPage(int cellSize, int pageId, const QImage& page, bool decodeAll) {
+  std::unique_lock<std::mutex> lock{emojiAtlasMutex};
+
+  EmojiAtlasPages& atlas = emojiAtlasPages[cellSize];
+  if (atlas.file) {
+    // already replaced by the written cache
+    return;
+  }
+
+  if (page.isNull()) {
+    // queued again by the next draw
+    atlas.queued[pageId] = false;
+    return;
+  }
+
+  if (!atlas.pages[pageId].isNull()) {
+    return;
+  }
+
+  atlas.pages[pageId] = page;
+  atlas.decodedLength += 1;
+
+  // without the other pages the cache is never written and every process would decode them again
+  if (decodeAll && !atlas.decodingAll) {
+    atlas.decodingAll = true;
+    for (int otherPageId = 0; otherPageId < emojiAtlasPageCount; otherPageId++) {
+      queueEmojiAtlasPage(cellSize, otherPageId, emojiAtlasBackgroundPriority);
+    }
+  }
+
+  std::vector<QImage> pages;
+  if (atlas.decodedLength == emojiAtlasPageCount) {
+    pages = atlas.pages;
+  }
+
+  lock.unlock();
+
+  emit getEmojiAtlasNotifier()->pageDecoded();
+
+  // every process maps them instead, including this one so the decoded pages can be released
+  if (!pages.empty() && writeEmojiAtlasCache(cellSize, pages)) {
+    EmojiAtlasPages mapped;
+    if (mapEmojiAtlasCache(cellSize, mapped)) {
+      lock.lock();
+      emojiAtlasPages[cellSize] = std::move(mapped);
+    }
+  }
+}
+
+class EmojiAtlasPageDecoder : public QRunnable {
+public:
+  EmojiAtlasPageDecoder(int cellSize, int pageId, bool decodeAll) : _cellSize(cellSize), _pageId(pageId), _decodeAll(decodeAll) {
+  }
+
+  void run() override {
+    storeEmojiAtlasPage(_cellSize, _pageId, readEmojiAtlasPage(_cellSize, _pageId), _decodeAll);
+  }
+
+private:
+  int _cellSize;
+  int _pageId;
+  bool _decodeAll;
+};
+
+// expects `emojiAtlasMutex` to be locked and the pages of `cellSize` to be decoded (not mapped)
+void queueEmojiAtlasPage(int cellSize, int pageId, int priority) {
+  EmojiAtlasPages& atlas = emojiAtlasPages[cellSize];
+  if (atlas.queued[pageId] || !atlas.pages[pageId].isNull()) {
+    return;
+  }
+
+  atlas.queued[pageId] = true;
+  getEmojiAtlasDecoders()->start(new EmojiAtlasPageDecoder(cellSize, pageId, priority != emojiAtlasBackgroundPriority), priority);
+}
+
+// expects `emojiAtlasMutex` to be locked
+EmojiAtlasPages& getEmojiAtlasPages(int cellSize) {
+  auto found = emojiAtlasPages.find(cellSize);
+  if (found != emojiAtlasPages.end()) {
+    return found->second;
+  }
+
+  EmojiAtlasPages& atlas = emojiAtlasPages[cellSize];
+  if (!mapEmojiAtlasCache(cellSize, atlas)) {
+    atlas.pages.assign(emojiAtlasPageCount, QImage{});
+    atlas.queued.assign(emojiAtlasPageCount, false);
+  }
+
+  return atlas;
+}
+
+// returns false if the page is not decoded yet, it is queued with `priority` then unless `queue` is false
+bool getEmojiAtlasPage(int emojiId, int cellSize, int priority, QImage& page, QRect& source, bool queue = true) {
+  int emojisLength = sizeof(emojis) / sizeof(Emoji);
+  if (emojiId < 0 || emojiId >= emojisLength) {
+    return false;
+  }
+
+  int pageId = emojiId / emojiAtlasPageLength;
+  int cell = emojiId % emojiAtlasPageLength;
+
+  source = QRect{(cell % emojiAtlasPageColumns) * cellSize, (cell / emojiAtlasPageColumns) * cellSize, cellSize, cellSize};
+
+  std::lock_guard<std::mutex> lock{emojiAtlasMutex};
+
+  EmojiAtlasPages& atlas = getEmojiAtlasPages(cellSize);
+  if (!atlas.pages[pageId].isNull()) {
+    page = atlas.pages[pageId];
+    return true;
+  }
+
+  if (queue) {
+    queueEmojiAtlasPage(cellSize, pageId, priority);
+  }
+
+  return false;
+}
+
+bool drawEmojiFromAtlas(QPainter& painter, const QRect& target, int emojiId, qreal pixelRatio) {
+  int cellSize = getEmojiAtlasCellSize(std::max(target.width(), target.height()) * pixelRatio);
+
+  QImage page;
+  QRect source;
+  if (!getEmojiAtlasPage(emojiId, cellSize, emojiAtlasDrawPriority, page, source)) {
+    return false;
+  }
+
+  painter.drawImage(target, page, source);
+  return true;
+}
+
+void prefetchEmojiFromAtlas(int emojiId, int size, qreal pixelRatio) {
+  int cellSize = getEmojiAtlasCellSize(size * pixelRatio);
+
+  QImage page;
+  QRect source;
+  getEmojiAtlasPage(emojiId, cellSize, emojiAtlasPrefetchPriority, page, source);
+}
+
+QPixmap getEmojiPixmapFromAtlas(int emojiId, int size, qreal pixelRatio) {
+  int emojisLength = sizeof(emojis) / sizeof(Emoji);
+  if (emojiId < 0 || emojiId >= emojisLength) {
+    return QPixmap{};
+  }
+
+  int devicePixels = size * pixelRatio;
+  int cellSize = getEmojiAtlasCellSize(devicePixels);
+
+  QImage page;
+  QRect source;
+  if (!getEmojiAtlasPage(emojiId, cellSize, emojiAtlasDrawPriority, page, source, false)) {
+    // decoded here, labels are also set while the picker is hidden and must not start decoding every page
+    int pageId = emojiId / emojiAtlasPageLength;
+    page = readEmojiAtlasPage(cellSize, pageId);
+    storeEmojiAtlasPage(cellSize, pageId, page, false);
+  }
+
+  if (page.isNull()) {
+    return QPixmap{};
+  }
+
+  QPixmap pixmap = QPixmap::fromImage(page.copy(source));
+  if (cellSize != devicePixels) {
+    pixmap = pixmap.scaled(devicePixels, devicePixels, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  }
+  pixmap.setDevicePixelRatio(pixelRatio);
+
+  return pixmap;
+}
+
+void releaseEmojiAtlas() {
+  std::lock_guard<std::mutex> lock{emojiAtlasMutex};
+
+  // decoded pages are kept, they are replaced by the mapping once the cache is written and would have to be decoded again
+  for (auto it = emojiAtlasPages.begin(); it != emojiAtlasPages.end();) {
+    if (it->second.file) {
+      it = emojiAtlasPages.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
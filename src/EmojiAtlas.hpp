@@ -0,0 +1,30 @@
+#pragma once
+
+#include <QObject>
+#include <QPainter>
+#include <QPixmap>
+#include <QRect>
+
+// emojis are drawn from the prescaled pages generated by tools/generate-emoji-atlas.cpp.
+// the pages of a cell size are decoded once into the cache directory and memory mapped from there.
+// until that cache exists the pages are decoded by a small thread pool and `pageDecoded` is emitted for each of them
+class EmojiAtlasNotifier : public QObject {
+  Q_OBJECT
+
+signals:
+  void pageDecoded();
+};
+
+EmojiAtlasNotifier* getEmojiAtlasNotifier();
+
+// returns false (and queues the page of the emoji) if the page is still being decoded
+bool drawEmojiFromAtlas(QPainter& painter, const QRect& target, int emojiId, qreal pixelRatio);
+
+// queues the page of the emoji with a lower priority than the pages that are drawn
+void prefetchEmojiFromAtlas(int emojiId, int size, qreal pixelRatio);
+
+// decodes the page on the calling thread if it is not ready yet
+QPixmap getEmojiPixmapFromAtlas(int emojiId, int size, qreal pixelRatio);
+
+// unmaps the pages of every cell size that was loaded from the cache, they are mapped again on the next draw
+void releaseEmojiAtlas();
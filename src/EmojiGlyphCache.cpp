@@ -0,0 +1,132 @@
+#include "EmojiGlyphCache.hpp"
+#include "emojis.hpp"
+#include <QCache>
+#include <QFontInfo>
+#include <QFontMetrics>
+#include <QHash>
+#include <QImage>
+#include <QPainter>
+#include <QRadialGradient>
+
+// least recently used glyphs are dropped first, a long running input method daemon must not keep every glyph it ever drew
+static QCache<QString, QPixmap> emojiGlyphPixmaps{256};
+
+void setEmojiGlyphCacheSize(int size) {
+  emojiGlyphPixmaps.setMaxCost(size);
+}
+
+void clearEmojiGlyphCache() {
+  emojiGlyphPixmaps.clear();
+}
+
+// one sprite per row height, highlight color and device pixel ratio, there are only a few of them
+static QHash<QString, QPixmap> emojiGlowSprites;
+
+void clearEmojiGlowSprites() {
+  emojiGlowSprites.clear();
+}
+
+QFont getEmojiGlyphFont(const QFont& baseFont, const EmojiPickerSettings& settings) {
+  QFont textFont = baseFont;
+
+  std::string fontOverride = settings.systemEmojiFontOverride();
+  if (!fontOverride.empty()) {
+    textFont.setFamily(QString::fromStdString(fontOverride));
+  }
+
+  return textFont;
+}
+
+QPixmap rasterizeEmojiGlyph(const QString& text, QFont textFont, const QColor& color, int devicePixels, bool useWidthHeuristics) {
+  textFont.setPixelSize(devicePixels);
+
+  if (useWidthHeuristics) {
+    QFontMetrics metrics{textFont};
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    int defaultEmojiWidth = metrics.horizontalAdvance("\U0001F600");
+    int textWidth = metrics.horizontalAdvance(text);
+#else
+    int defaultEmojiWidth = metrics.width("\U0001F600");
+    int textWidth = metrics.width(text);
+#endif
+    if (textWidth > defaultEmojiWidth) {
+      double multiplier = (double)defaultEmojiWidth / (double)textWidth;
+      textFont.setPixelSize((double)textFont.pixelSize() * multiplier);
+    }
+  }
+
+  QImage image{(int)(devicePixels * 1.10), (int)(devicePixels * 1.10), QImage::Format_ARGB32_Premultiplied};
+  image.fill(Qt::transparent);
+
+  QPainter painter{&image};
+  painter.setFont(textFont);
+  painter.setPen(color);
+  painter.drawText(image.rect(), Qt::AlignCenter, text);
+  painter.end();
+
+  return QPixmap::fromImage(image);
+}
+
+QPixmap getEmojiGlyphPixmap(int emojiId, int size, qreal pixelRatio, const QFont& baseFont, const QColor& color, const EmojiPickerSettings& settings) {
+  int emojisLength = sizeof(emojis) / sizeof(Emoji);
+  if (emojiId < 0 || emojiId >= emojisLength) {
+    return QPixmap{};
+  }
+
+  QFont textFont = getEmojiGlyphFont(baseFont, settings);
+  int devicePixels = size * pixelRatio;
+  bool useWidthHeuristics = settings.useSystemEmojiFontWidthHeuristics();
+
+  // the resolved family, an override that is not installed falls back to the same glyphs as no override.
+  // the color only matters for fonts without color glyphs
+  QString key = QString("%1:%2:%3:%4:%5:%6").arg(QFontInfo{textFont}.family()).arg(devicePixels).arg(pixelRatio).arg(useWidthHeuristics).arg(color.rgba()).arg(emojiId);
+
+  if (QPixmap* found = emojiGlyphPixmaps.object(key)) {
+    return *found;
+  }
+
+  const Emoji& emoji = emojis[emojiId];
+  QPixmap pixmap = rasterizeEmojiGlyph(QString::fromUtf8(emoji.code.data(), emoji.code.size()), textFont, color, devicePixels, useWidthHeuristics);
+  pixmap.setDevicePixelRatio(pixelRatio);
+
+  emojiGlyphPixmaps.insert(key, new QPixmap(pixmap));
+
+  return pixmap;
+}
+
+QPixmap getEmojiGlowSprite(int size, const QColor& color, qreal pixelRatio) {
+  QString key = QString("%1:%2:%3").arg(size).arg(color.rgba()).arg(pixelRatio);
+  auto found = emojiGlowSprites.constFind(key);
+  if (found != emojiGlowSprites.constEnd()) {
+    return *found;
+  }
+
+  int devicePixels = size * pixelRatio;
+
+  QImage image{devicePixels, devicePixels, QImage::Format_ARGB32_Premultiplied};
+  image.fill(Qt::transparent);
+
+  // about what the blurred drop shadow (blur radius 20) looked like behind an emoji
+  QColor innerColor = color;
+  innerColor.setAlphaF(0.55);
+  QColor middleColor = color;
+  middleColor.setAlphaF(0.2);
+  QColor outerColor = color;
+  outerColor.setAlphaF(0);
+
+  QRadialGradient gradient{devicePixels / 2.0, devicePixels / 2.0, devicePixels / 2.0};
+  gradient.setColorAt(0, innerColor);
+  gradient.setColorAt(0.6, middleColor);
+  gradient.setColorAt(1, outerColor);
+
+  QPainter painter{&image};
+  painter.fillRect(image.rect(), gradient);
+  painter.end();
+
+  QPixmap sprite = QPixmap::fromImage(image);
+  sprite.setDevicePixelRatio(pixelRatio);
+
+  emojiGlowSprites.insert(key, sprite);
+
+  return sprite;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "EmojiPickerSettings.hpp"
+#include <QColor>
+#include <QFont>
+#include <QPixmap>
+
+// with `useSystemEmojiFont` every emoji is rasterized once per font family, pixel size and device pixel ratio.
+// color emoji fonts are expensive to shape and rasterize so the grid and the labels only draw these pixmaps.
+// only the most recently drawn glyphs are kept, see `setEmojiGlyphCacheSize`
+QPixmap getEmojiGlyphPixmap(int emojiId, int size, qreal pixelRatio, const QFont& baseFont, const QColor& color, const EmojiPickerSettings& settings);
+
+// the number of glyphs kept, the grid sizes it to the visible rows and the rows it prefetches
+void setEmojiGlyphCacheSize(int size);
+
+void clearEmojiGlyphCache();
+
+// the highlight of a selected emoji, a soft glow around it that is rendered once per size and color
+QPixmap getEmojiGlowSprite(int size, const QColor& color, qreal pixelRatio);
+
+void clearEmojiGlowSprites();
@@ -0,0 +1,363 @@
+#include "EmojiGrid.hpp"
+#include "EmojiAtlas.hpp"
+#include "EmojiGlyphCache.hpp"
+#include <QHelpEvent>
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QResizeEvent>
+#include <QToolTip>
+#include <algorithm>
+
+EmojiGrid::EmojiGrid(QWidget* parent, const EmojiPickerSettings& settings, int columnCount) : QWidget(parent), _settings(settings), _columnCount(columnCount) {
+  setFocusPolicy(Qt::NoFocus);
+  setMouseTracking(true);
+  // the scroll area has to keep the height of all rows so it can scroll
+  setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+
+  _highlightColor = QColor(240, 240, 240);
+  if (_settings.useSystemQtTheme()) {
+    _highlightColor = palette().text().color();
+  }
+
+  // cells of pages that were still decoded show a placeholder until then
+  QObject::connect(getEmojiAtlasNotifier(), &EmojiAtlasNotifier::pageDecoded, this, [this]() {
+    update();
+  });
+}
+
+int EmojiGrid::columnCount() const {
+  return _columnCount;
+}
+
+int EmojiGrid::rowCount() const {
+  return _cells.size() / _columnCount;
+}
+
+void EmojiGrid::beginUpdate() {
+  // swapping keeps the allocations of both lists for the next update
+  std::swap(_items, _previousItems);
+  _items.clear();
+  _cells.clear();
+  _nextRow = 0;
+  _nextColumn = 0;
+
+  _updating = true;
+}
+
+void EmojiGrid::endUpdate() {
+  _updating = false;
+
+  int previousRowCount = 0;
+  for (const EmojiGridItem& item : _previousItems) {
+    previousRowCount = std::max(previousRowCount, item.row + 1);
+  }
+
+  if (previousRowCount != rowCount()) {
+    updateGeometry();
+  }
+
+  // an item is unchanged if the same emoji is still at the same position
+  std::vector<QRect> changedRects;
+  std::size_t changedLength = 0;
+  std::size_t commonLength = std::min(_items.size(), _previousItems.size());
+  for (std::size_t index = 0; index < commonLength; index++) {
+    const EmojiGridItem& item = _items[index];
+    const EmojiGridItem& previousItem = _previousItems[index];
+    if (item.emoji == previousItem.emoji && item.row == previousItem.row && item.column == previousItem.column && item.colspan == previousItem.colspan) {
+      continue;
+    }
+
+    changedRects.push_back(itemRect(previousItem));
+    changedRects.push_back(itemRect(item));
+    changedLength += 1;
+  }
+
+  for (std::size_t index = commonLength; index < _previousItems.size(); index++) {
+    changedRects.push_back(itemRect(_previousItems[index]));
+    changedLength += 1;
+  }
+
+  for (std::size_t index = commonLength; index < _items.size(); index++) {
+    changedRects.push_back(itemRect(_items[index]));
+    changedLength += 1;
+  }
+
+  // the rows outside of the scroll area viewport are painted when they are scrolled in anyways.
+  // if more cells changed than are visible (a new query, switching to the full list) a single update is cheaper
+  QRect visible = visibleRegion().boundingRect();
+  std::size_t visibleCellsLength = (visible.height() / _rowHeight + 2) * _columnCount;
+  if (changedLength > visibleCellsLength) {
+    update();
+  } else {
+    for (const QRect& rect : changedRects) {
+      if (rect.intersects(visible)) {
+        update(rect);
+      }
+    }
+  }
+
+  // the cells of removed items were repainted above, the caller selects one of the new items
+  if (_selectedItem >= (int)_items.size()) {
+    _selectedItem = -1;
+  }
+  if (_hoveredItem >= (int)_items.size()) {
+    _hoveredItem = -1;
+  }
+
+  _previousItems.clear();
+}
+
+void EmojiGrid::addEmoji(const Emoji& emoji) {
+  EmojiGridItem item;
+  item.emoji = emoji;
+  item.emojiId = emojiIdByCode(emoji.code);
+  item.hasRealEmoji = item.emojiId != -1;
+  item.colspan = item.hasRealEmoji ? 1 : 2;
+
+  if ((_nextColumn + item.colspan) > _columnCount) {
+    _nextColumn = 0;
+    _nextRow += 1;
+  }
+
+  item.row = _nextRow;
+  item.column = _nextColumn;
+
+  std::size_t cellsLength = (item.row + 1) * _columnCount;
+  if (_cells.size() < cellsLength) {
+    _cells.resize(cellsLength, -1);
+  }
+
+  for (int column = item.column; column < item.column + item.colspan; column++) {
+    _cells[item.row * _columnCount + column] = _items.size();
+  }
+
+  _items.push_back(item);
+
+  _nextColumn += item.colspan;
+  if (_nextColumn >= _columnCount) {
+    _nextColumn = 0;
+    _nextRow += 1;
+  }
+
+  if (_updating) {
+    return;
+  }
+
+  updateGeometry();
+  update(itemRect(item));
+}
+
+const EmojiGridItem* EmojiGrid::itemAt(int row, int column) const {
+  if (row < 0 || column < 0 || row >= rowCount() || column >= _columnCount) {
+    return nullptr;
+  }
+
+  int index = _cells[row * _columnCount + column];
+  if (index == -1) {
+    return nullptr;
+  }
+
+  return &_items[index];
+}
+
+int EmojiGrid::columnWidth() const {
+  return std::max((width() - _margins.left() - _margins.right()) / _columnCount, 1);
+}
+
+QRect EmojiGrid::itemRect(const EmojiGridItem& item) const {
+  int w = columnWidth();
+
+  return QRect{_margins.left() + item.column * w, _margins.top() + item.row * _rowHeight, item.colspan * w, _rowHeight};
+}
+
+void EmojiGrid::setSelectedItem(const EmojiGridItem* item) {
+  int index = item ? item - _items.data() : -1;
+  if (index == _selectedItem) {
+    return;
+  }
+
+  updateItem(_selectedItem);
+  _selectedItem = index;
+  updateItem(_selectedItem);
+}
+
+QSize EmojiGrid::sizeHint() const {
+  return QSize{_margins.left() + _columnCount * 33 + _margins.right(), _margins.top() + rowCount() * _rowHeight + _margins.bottom()};
+}
+
+int EmojiGrid::itemIndexAt(const QPoint& pos) const {
+  if (pos.y() < _margins.top() || pos.x() < _margins.left()) {
+    return -1;
+  }
+
+  int row = (pos.y() - _margins.top()) / _rowHeight;
+  int column = (pos.x() - _margins.left()) / columnWidth();
+
+  const EmojiGridItem* item = itemAt(row, column);
+  if (!item) {
+    return -1;
+  }
+
+  return item - _items.data();
+}
+
+void EmojiGrid::updateItem(int index) {
+  if (index == -1) {
+    return;
+  }
+
+  update(itemRect(_items[index]));
+}
+
+bool EmojiGrid::event(QEvent* event) {
+  if (event->type() == QEvent::ToolTip) {
+    QHelpEvent* helpEvent = static_cast<QHelpEvent*>(event);
+
+    int index = itemIndexAt(helpEvent->pos());
+    if (index == -1) {
+      QToolTip::hideText();
+      event->ignore();
+      return true;
+    }
+
+    const EmojiGridItem& item = _items[index];
+    QToolTip::showText(helpEvent->globalPos(), tr(std::string{item.emoji.name}.c_str()), this, itemRect(item));
+    return true;
+  }
+
+  return QWidget::event(event);
+}
+
+void EmojiGrid::paintEvent(QPaintEvent* event) {
+  if (_items.empty()) {
+    return;
+  }
+
+  QPainter painter{this};
+  painter.setRenderHint(QPainter::Antialiasing);
+  painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+  double pixelRatio = std::max(devicePixelRatioF(), 1.0);
+
+  QFont kaomojiFont = font();
+  kaomojiFont.setPixelSize(_emojiSize.width() * 0.45);
+
+  QColor selectedColor = _highlightColor;
+  selectedColor.setAlphaF(0.2);
+  QColor hoveredColor = _highlightColor;
+  hoveredColor.setAlphaF(0.1);
+  QColor placeholderColor = _highlightColor;
+  placeholderColor.setAlphaF(0.05);
+
+  QRect exposed = event->rect();
+  int firstRow = std::max((exposed.top() - _margins.top()) / _rowHeight, 0);
+  int lastRow = std::min((exposed.bottom() - _margins.top()) / _rowHeight, rowCount() - 1);
+
+  for (int row = firstRow; row <= lastRow; row++) {
+    for (int column = 0; column < _columnCount; column++) {
+      int index = _cells[row * _columnCount + column];
+      if (index == -1) {
+        continue;
+      }
+
+      const EmojiGridItem& item = _items[index];
+      // kaomojis span over multiple cells but are only painted once
+      if (item.column != column) {
+        continue;
+      }
+
+      QRect rect = itemRect(item);
+
+      if (index == _selectedItem && item.hasRealEmoji) {
+        QPixmap glow = getEmojiGlowSprite(_rowHeight, _highlightColor, pixelRatio);
+
+        QRect target{QPoint{0, 0}, QSize{_rowHeight, _rowHeight}};
+        target.moveCenter(rect.center());
+        painter.drawPixmap(target, glow);
+      } else if (index == _selectedItem || index == _hoveredItem) {
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(index == _selectedItem ? selectedColor : hoveredColor);
+        painter.drawRoundedRect(rect.adjusted(1, 1, -1, -1), 5, 5);
+      }
+
+      if (item.hasRealEmoji && !_settings.useSystemEmojiFont()) {
+        QRect target{QPoint{0, 0}, _emojiSize};
+        target.moveCenter(rect.center());
+        if (!drawEmojiFromAtlas(painter, target, item.emojiId, pixelRatio)) {
+          painter.setPen(Qt::NoPen);
+          painter.setBrush(placeholderColor);
+          painter.drawRoundedRect(target.adjusted(3, 3, -3, -3), 4, 4);
+        }
+      } else if (item.hasRealEmoji) {
+        QPixmap pixmap = getEmojiGlyphPixmap(item.emojiId, _emojiSize.height(), pixelRatio, font(), palette().color(foregroundRole()), _settings);
+
+        QRect target{QPoint{0, 0}, pixmap.size() / pixmap.devicePixelRatio()};
+        target.moveCenter(rect.center());
+        painter.drawPixmap(target, pixmap);
+      } else {
+        QString text = QString::fromUtf8(item.emoji.code.data(), item.emoji.code.size());
+
+        painter.setFont(kaomojiFont);
+        painter.setPen(palette().color(foregroundRole()));
+        painter.drawText(rect, Qt::AlignCenter, painter.fontMetrics().elidedText(text, Qt::ElideRight, rect.width()));
+      }
+    }
+  }
+
+  // the rows next to the painted ones in scroll direction, so paging through the list doesn't hit pages that are still decoded
+  if (!_settings.useSystemEmojiFont()) {
+    bool scrollsUp = firstRow < _lastPaintedRow;
+    int prefetchBegin = scrollsUp ? std::max(firstRow - _prefetchRows, 0) : lastRow + 1;
+    int prefetchEnd = scrollsUp ? firstRow : std::min(lastRow + 1 + _prefetchRows, rowCount());
+
+    for (int row = prefetchBegin; row < prefetchEnd; row++) {
+      for (int column = 0; column < _columnCount; column++) {
+        int index = _cells[row * _columnCount + column];
+        if (index != -1 && _items[index].hasRealEmoji) {
+          prefetchEmojiFromAtlas(_items[index].emojiId, _emojiSize.width(), pixelRatio);
+        }
+      }
+    }
+
+    _lastPaintedRow = firstRow;
+  }
+}
+
+void EmojiGrid::mousePressEvent(QMouseEvent* event) {
+  int index = itemIndexAt(event->pos());
+  if (index == -1) {
+    QWidget::mousePressEvent(event);
+    return;
+  }
+
+  // committing can change the list so the item must not be referenced while emitting
+  EmojiGridItem item = _items[index];
+  emit emojiPressed(item.emoji, item.hasRealEmoji);
+}
+
+void EmojiGrid::mouseMoveEvent(QMouseEvent* event) {
+  int index = itemIndexAt(event->pos());
+  if (index != _hoveredItem) {
+    updateItem(_hoveredItem);
+    _hoveredItem = index;
+    updateItem(_hoveredItem);
+  }
+
+  QWidget::mouseMoveEvent(event);
+}
+
+void EmojiGrid::resizeEvent(QResizeEvent* event) {
+  QWidget::resizeEvent(event);
+
+  // the scroll area viewport, the glyphs of every visible row and the rows around it in both directions are kept
+  int visibleRows = (parentWidget() ? parentWidget()->height() : height()) / _rowHeight + 1;
+  setEmojiGlyphCacheSize((visibleRows + 2 * _prefetchRows) * _columnCount);
+}
+
+void EmojiGrid::leaveEvent(QEvent* event) {
+  updateItem(_hoveredItem);
+  _hoveredItem = -1;
+
+  QWidget::leaveEvent(event);
+}
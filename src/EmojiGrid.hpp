@@ -0,0 +1,87 @@
+#pragma once
+
+#include "EmojiPickerSettings.hpp"
+#include "emojis.hpp"
+#include <QColor>
+#include <QPixmap>
+#include <QWidget>
+#include <vector>
+
+struct EmojiGridItem {
+  Emoji emoji;
+  int emojiId = -1;
+  bool hasRealEmoji = false;
+  int row = 0;
+  int column = 0;
+  int colspan = 1;
+};
+
+// paints the whole emoji list itself instead of creating one widget per emoji.
+// only the rows intersecting the exposed rect are painted and the emoji images come from the emoji atlas (or the glyph cache)
+class EmojiGrid : public QWidget {
+  Q_OBJECT
+
+public:
+  explicit EmojiGrid(QWidget* parent, const EmojiPickerSettings& settings, int columnCount);
+
+  int columnCount() const;
+  int rowCount() const;
+
+  // the emojis added until `endUpdate` replace the current ones.
+  // only the cells that differ from the previous list are repainted, so typing a character touches a few cells instead of the whole grid
+  void beginUpdate();
+  void endUpdate();
+
+  // places the emoji right after the previous one, kaomojis take 2 columns
+  void addEmoji(const Emoji& emoji);
+
+  const EmojiGridItem* itemAt(int row, int column) const;
+  QRect itemRect(const EmojiGridItem& item) const;
+
+  void setSelectedItem(const EmojiGridItem* item);
+
+  QSize sizeHint() const override;
+
+signals:
+  void emojiPressed(const Emoji& emoji, bool hasRealEmoji);
+
+protected:
+  bool event(QEvent* event) override;
+  void paintEvent(QPaintEvent* event) override;
+  void mousePressEvent(QMouseEvent* event) override;
+  void mouseMoveEvent(QMouseEvent* event) override;
+  void leaveEvent(QEvent* event) override;
+  void resizeEvent(QResizeEvent* event) override;
+
+private:
+  const EmojiPickerSettings& _settings;
+
+  int _columnCount;
+  int _rowHeight = 30;
+  QSize _emojiSize{24, 24};
+  QMargins _margins{4, 4, 4, 4};
+
+  std::vector<EmojiGridItem> _items;
+  // `row * _columnCount + column` -> index into `_items` or -1
+  std::vector<int> _cells;
+  int _nextRow = 0;
+  int _nextColumn = 0;
+
+  // the items before `beginUpdate`, compared against the new ones in `endUpdate`
+  std::vector<EmojiGridItem> _previousItems;
+  bool _updating = false;
+
+  int _selectedItem = -1;
+  int _hoveredItem = -1;
+
+  // the scroll direction for prefetching
+  int _lastPaintedRow = 0;
+  int _prefetchRows = 5;
+
+  QColor _highlightColor;
+
+  int columnWidth() const;
+
+  int itemIndexAt(const QPoint& pos) const;
+  void updateItem(int index);
+};
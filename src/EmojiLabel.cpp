@@ -1,94 +1,88 @@
 #include "EmojiLabel.hpp"
+#include "EmojiAtlas.hpp"
+#include "EmojiGlyphCache.hpp"
 #include <QApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QFontInfo>
+#include <QPainter>
 #include <QScreen>
+#include <QStandardPaths>
 #include <QWindow>
-#include <sstream>
-#include "utf8.h"
+#include <algorithm>
 
 EmojiLabel::EmojiLabel(QWidget* parent, const EmojiPickerSettings& settings) : QLabel(parent), _settings(settings) {
   setProperty("class", "EmojiLabel");
-  setGraphicsEffect(_shadowEffect);
   setMouseTracking(true);
 
-  _shadowColor = QColor(240, 240, 240);
+  _highlightColor = QColor(240, 240, 240);
   if (_settings.useSystemQtTheme()) {
-    _shadowColor = palette().text().color();
+    _highlightColor = palette().text().color();
   }
-
-  _shadowEffect->setColor(_shadowColor);
-  _shadowEffect->setOffset(0);
-  _shadowEffect->setBlurRadius(20);
-  _shadowEffect->setEnabled(false);
 }
 
 EmojiLabel::EmojiLabel(QWidget* parent, const EmojiPickerSettings& settings, const Emoji& emoji) : EmojiLabel(parent, settings) {
   setEmoji(emoji);
 }
 
-void getCodepointsByEmojiStr(const std::string& emojiStr, const std::string& separator, std::stringstream& emojiHexCodeStream) {
-  const utf8_int8_t* ptr = (const utf8_int8_t*)emojiStr.data();
-  utf8_int32_t codepoint = 0;
-
-  while (true) {
-    bool first = codepoint == 0;
-
-    ptr = utf8codepoint(ptr, &codepoint);
-    if (codepoint == 0) {
-      break;
+// installing or removing fonts changes the modification time of a font directory (or of one of its subdirectories)
+qint64 getNewestFontDirectoryModification() {
+  QStringList fontDirectories = QStandardPaths::standardLocations(QStandardPaths::FontsLocation);
+  fontDirectories << "/usr/share/fonts"
+                  << "/usr/local/share/fonts"
+                  << QDir::homePath() + "/.fonts";
+
+  qint64 newest = 0;
+  for (const QString& fontDirectory : fontDirectories) {
+    QFileInfo info{fontDirectory};
+    if (!info.isDir()) {
+      continue;
     }
 
-    if (!first) {
-      emojiHexCodeStream << separator;
+    newest = std::max(newest, info.lastModified().toMSecsSinceEpoch());
+    for (const QFileInfo& subdirectory : QDir{fontDirectory}.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+      newest = std::max(newest, subdirectory.lastModified().toMSecsSinceEpoch());
     }
-
-    emojiHexCodeStream << std::hex << codepoint;
   }
-}
 
-std::string getCodepointsByEmojiStr(const std::string& emojiStr, const std::string& separator) {
-  std::stringstream emojiHexCodeStream;
-  getCodepointsByEmojiStr(emojiStr, separator, emojiHexCodeStream);
-  return emojiHexCodeStream.str();
+  return newest;
 }
 
-// fdm `:/res/72x72/${[...emojiStr].map(c => c.codePointAt(0).toString(16)).join('-')}.png`
-std::string getPixmapPathByEmojiStr(const std::string& emojiStr) {
-  std::stringstream emojiHexCodeStream;
-
-  emojiHexCodeStream << ":/res/72x72/";
-  getCodepointsByEmojiStr(emojiStr, "-", emojiHexCodeStream);
-  emojiHexCodeStream << ".png";
+std::vector<bool> fontSupportedEmojis(const QFont& font) {
+  int emojisLength = sizeof(emojis) / sizeof(Emoji);
 
-  return emojiHexCodeStream.str();
-}
-
-QPixmap getPixmapByEmojiStr(const std::string& emojiStr) {
-  return QPixmap(QString::fromStdString(getPixmapPathByEmojiStr(emojiStr)), "PNG");
-}
+  // Qt has no api for the font files (or their fallbacks) so the resolved font and the font directories stand in for them
+  QFontInfo fontInfo{font};
+  QString fontKey = QString("%1:%2:%3:%4:%5:%6").arg(fontInfo.family()).arg(fontInfo.styleName()).arg(fontInfo.pixelSize()).arg(getNewestFontDirectoryModification()).arg(QCoreApplication::applicationVersion()).arg(emojisLength);
 
-int defaultEmojiWidth = 0;
-int invalidEmojiWidth = 0;
+  EmojiPickerCache cache;
+  std::vector<bool> result = cache.emojiFontSupport(fontKey);
+  if ((int)result.size() == emojisLength) {
+    return result;
+  }
 
-bool fontSupportsEmoji(const QFontMetrics& metrics, int textWidth) {
-  if (invalidEmojiWidth == 0) {
+  // the width of the replacement character is what missing emojis (and every fallback) are rendered with
+  QFontMetrics metrics{font};
 #if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
-    invalidEmojiWidth = metrics.horizontalAdvance("\U0001FFFD");
+  int invalidWidth = metrics.horizontalAdvance("\U0001FFFD");
 #else
-    invalidEmojiWidth = metrics.width("\U0001FFFD");
+  int invalidWidth = metrics.width("\U0001FFFD");
 #endif
-  }
-
-  return textWidth != invalidEmojiWidth;
-}
 
-bool fontSupportsEmoji(const QFontMetrics& metrics, const QString& text) {
+  result.assign(emojisLength, false);
+  for (int emojiId = 0; emojiId < emojisLength; emojiId++) {
+    QString text = QString::fromUtf8(emojis[emojiId].code.data(), emojis[emojiId].code.size());
 #if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
-  int textWidth = metrics.horizontalAdvance(text);
+    result[emojiId] = metrics.horizontalAdvance(text) != invalidWidth;
 #else
-  int textWidth = metrics.width(text);
+    result[emojiId] = metrics.width(text) != invalidWidth;
 #endif
+  }
+
+  cache.emojiFontSupport(fontKey, result);
 
-  return fontSupportsEmoji(metrics, textWidth);
+  return result;
 }
 
 const Emoji& EmojiLabel::emoji() const {
@@ -103,54 +97,17 @@ void EmojiLabel::setEmoji(const Emoji& emoji, int w, int h) {
   w = w * pixelRatio;
   h = h * pixelRatio;
 
-  setAccessibleName(QString::fromStdString(_emoji.name));
+  setAccessibleName(QString::fromUtf8(_emoji.name.data(), _emoji.name.size()));
 
-  QPixmap emojiPixmap = getPixmapByEmojiStr(_emoji.code);
-  _hasRealEmoji = !emojiPixmap.isNull();
+  int emojiId = emojiIdByCode(_emoji.code);
+  _hasRealEmoji = emojiId != -1;
 
   if (_hasRealEmoji && !_settings.useSystemEmojiFont()) {
-    emojiPixmap = emojiPixmap.scaled(w, h, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-    emojiPixmap.setDevicePixelRatio(pixelRatio);
-
-    setPixmap(emojiPixmap);
+    setPixmap(getEmojiPixmapFromAtlas(emojiId, w / pixelRatio, pixelRatio));
   } else if (_hasRealEmoji) {
-    QString text = QString::fromStdString(_emoji.code);
-
-    QFont textFont = font();
-    textFont.setPixelSize(w);
-
-    std::string fontOverride = _settings.systemEmojiFontOverride();
-    if (!fontOverride.empty()) {
-      textFont.setFamily(QString::fromStdString(fontOverride));
-    }
-
-    if (_settings.useSystemEmojiFontWidthHeuristics()) {
-      if (defaultEmojiWidth == 0) {
-#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
-        defaultEmojiWidth = fontMetrics().horizontalAdvance("\U0001F600");
-#else
-        defaultEmojiWidth = fontMetrics().width("\U0001F600");
-#endif
-      }
-
-#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
-      int textWidth = fontMetrics().horizontalAdvance(text);
-#else
-      int textWidth = fontMetrics().width(text);
-#endif
-      if (textWidth > defaultEmojiWidth) {
-        double multiplier = (double)defaultEmojiWidth / (double)textWidth;
-        textFont.setPixelSize((double)textFont.pixelSize() * multiplier);
-      }
-    }
-
-    textFont.setPixelSize((double)textFont.pixelSize() / pixelRatio);
-
-    setFont(textFont);
-    setText(text);
-    setMaximumSize(w * 1.10, h * 1.10);
+    setPixmap(getEmojiGlyphPixmap(emojiId, w / pixelRatio, pixelRatio, font(), palette().color(foregroundRole()), _settings));
   } else {
-    QString text = QString::fromStdString(_emoji.code);
+    QString text = QString::fromUtf8(_emoji.code.data(), _emoji.code.size());
 
     QFont textFont = font();
     textFont.setPixelSize((double)w * 0.45 / pixelRatio);
@@ -166,19 +123,13 @@ bool EmojiLabel::highlighted() const {
 }
 
 void EmojiLabel::setHighlighted(bool highlighted) {
-  _highlighted = highlighted;
+  if (_highlighted == highlighted) {
+    return;
+  }
 
-  _shadowEffect->setEnabled(_highlighted);
+  _highlighted = highlighted;
 
-  if (!_hasRealEmoji) {
-    if (_highlighted) {
-      QColor emojiLabelHoverBgColor = _shadowColor;
-      emojiLabelHoverBgColor.setAlphaF(0.1);
-      setStyleSheet(QString("background-color: #%1").arg(emojiLabelHoverBgColor.rgba(), 0, 16));
-    } else {
-      setStyleSheet(QString());
-    }
-  }
+  update();
 }
 
 void EmojiLabel::mousePressEvent(QMouseEvent* ev) {
@@ -195,6 +146,30 @@ void EmojiLabel::mouseMoveEvent(QMouseEvent* ev) {
   QLabel::mouseMoveEvent(ev);
 }
 
+void EmojiLabel::paintEvent(QPaintEvent* ev) {
+  if (_highlighted) {
+    QPainter painter{this};
+
+    if (_hasRealEmoji) {
+      int size = std::max(width(), height());
+      QRect target{QPoint{0, 0}, QSize{size, size}};
+      target.moveCenter(rect().center());
+
+      painter.drawPixmap(target, getEmojiGlowSprite(size, _highlightColor, std::max(devicePixelRatioF(), 1.0)));
+    } else {
+      QColor backgroundColor = _highlightColor;
+      backgroundColor.setAlphaF(0.1);
+
+      painter.setRenderHint(QPainter::Antialiasing);
+      painter.setPen(Qt::NoPen);
+      painter.setBrush(backgroundColor);
+      painter.drawRoundedRect(rect(), 5, 5);
+    }
+  }
+
+  QLabel::paintEvent(ev);
+}
+
 bool EmojiLabel::hasRealEmoji() const {
   return _hasRealEmoji;
 }
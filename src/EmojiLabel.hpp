@@ -1,7 +1,6 @@
 #pragma once
 
 #include "emojis.hpp"
-#include <QGraphicsDropShadowEffect>
 #include <QLabel>
 #include <QPixmap>
 #include "EmojiPickerSettings.hpp"
@@ -27,6 +26,7 @@ signals:
 protected:
   void mousePressEvent(QMouseEvent* ev) override;
   void mouseMoveEvent(QMouseEvent* ev) override;
+  void paintEvent(QPaintEvent* ev) override;
 
 private:
   Emoji _emoji;
@@ -34,10 +34,10 @@ private:
 
   bool _highlighted = false;
 
-  QColor _shadowColor;
-  QGraphicsDropShadowEffect* _shadowEffect = new QGraphicsDropShadowEffect(this);
+  QColor _highlightColor;
 
   const EmojiPickerSettings& _settings;
 };
 
-bool fontSupportsEmoji(const QFontMetrics& metrics, const QString& text);
+// one bit per emoji (index into `emojis`), measured once per font configuration and kept in the cache
+std::vector<bool> fontSupportedEmojis(const QFont& font);
@@ -1,7 +1,9 @@
 #include "EmojiPickerSettings.hpp"
 #include "EmojiLabel.hpp"
+#include "kaomojis.hpp"
 #include <QCoreApplication>
 #include <QStandardPaths>
+#include <algorithm>
 
 template <typename T>
 std::vector<T> readQSettingsArrayToStdVector(QSettings& settings, const QString& prefix, std::function<T(QSettings&)> readValue, const std::vector<T>& defaultValue = {}) {
@@ -50,6 +52,8 @@ void EmojiPickerSettings::writeDefaultsToDisk() {
   s.systemEmojiFontOverride(s.systemEmojiFontOverride());
   s.scaleFactor(s.scaleFactor());
   s.saveKaomojiInMRU(s.saveKaomojiInMRU());
+  s.fuzzySearch(s.fuzzySearch());
+  s.releaseCachesAfterIdleSeconds(s.releaseCachesAfterIdleSeconds());
   s.customHotKeys(s.customHotKeys());
 }
 
@@ -88,26 +92,59 @@ void EmojiPickerSettings::maxEmojiVersion(int maxEmojiVersion) {
   setValue("maxEmojiVersion", maxEmojiVersion);
 }
 
-bool EmojiPickerSettings::isDisabledEmoji(const Emoji& emoji, const QFontMetrics& fontMetrics) {
-  if (maxEmojiVersion() != -1 && (emoji.version > maxEmojiVersion())) {
-    return true;
-  }
+bool EmojiFilter::operator==(const EmojiFilter& other) const {
+  return maxEmojiVersion == other.maxEmojiVersion && disabledFlags == other.disabledFlags && checkFontSupport == other.checkFontSupport;
+}
+
+bool EmojiFilter::operator!=(const EmojiFilter& other) const {
+  return !(*this == other);
+}
 
-  if (skinTonesDisabled() && emoji.isSkinToneVariation()) {
-    return true;
+EmojiFilter EmojiPickerSettings::emojiFilter() const {
+  EmojiFilter filter;
+  filter.maxEmojiVersion = maxEmojiVersion();
+
+  if (skinTonesDisabled()) {
+    filter.disabledFlags |= Emoji::SKIN_TONE_VARIATION;
+  }
+  if (gendersDisabled()) {
+    filter.disabledFlags |= Emoji::GENDER_VARIATION;
   }
 
-  if (gendersDisabled() && emoji.isGenderVariation()) {
-    return true;
+  filter.checkFontSupport = useSystemEmojiFont() && useSystemEmojiFontWidthHeuristics();
+
+  return filter;
+}
+
+std::vector<bool> EmojiPickerSettings::disabledEmojis(const EmojiFilter& filter, const QFont& font) {
+  int emojisLength = sizeof(emojis) / sizeof(Emoji);
+  std::vector<bool> result(emojisLength, false);
+
+  std::vector<bool> supportedEmojis;
+  if (filter.checkFontSupport) {
+    supportedEmojis = fontSupportedEmojis(font);
   }
 
-  if (useSystemEmojiFont() && useSystemEmojiFontWidthHeuristics()) {
-    if (!fontSupportsEmoji(fontMetrics, QString::fromStdString(emoji.code))) {
-      return true;
+  for (int emojiId = 0; emojiId < emojisLength; emojiId++) {
+    const Emoji& emoji = emojis[emojiId];
+
+    if ((emoji.flags & filter.disabledFlags) != 0) {
+      result[emojiId] = true;
+      continue;
+    }
+
+    if (filter.maxEmojiVersion != -1 && emoji.version > filter.maxEmojiVersion) {
+      result[emojiId] = true;
+      continue;
+    }
+
+    if (filter.checkFontSupport && !supportedEmojis[emojiId]) {
+      result[emojiId] = true;
+      continue;
     }
   }
 
-  return false;
+  return result;
 }
 
 std::vector<std::string> defaultEmojiAliasFiles = {
@@ -126,8 +163,8 @@ void EmojiPickerSettings::emojiAliasFiles(const std::vector<std::string>& emojiA
   });
 }
 
-std::unordered_map<std::string, std::vector<QString>> EmojiPickerSettings::emojiAliases() {
-  std::unordered_map<std::string, std::vector<QString>> result;
+std::vector<std::vector<QString>> EmojiPickerSettings::emojiAliases() {
+  std::vector<std::vector<QString>> result(sizeof(emojis) / sizeof(Emoji));
 
   for (const std::string& path : emojiAliasFiles()) {
     QSettings emojiAliasesIni{QString::fromStdString(path), QSettings::IniFormat};
@@ -139,7 +176,12 @@ std::unordered_map<std::string, std::vector<QString>> EmojiPickerSettings::emoji
       auto alias = emojiAliasesIni.value("alias").toString();
       auto value = emojiAliasesIni.value("value").toString().toStdString();
 
-      result[value].push_back(alias);
+      int emojiId = emojiIdByCode(value);
+      if (emojiId == -1) {
+        continue;
+      }
+
+      result[emojiId].push_back(alias);
     }
     emojiAliasesIni.endArray();
   }
@@ -211,6 +253,22 @@ void EmojiPickerSettings::saveKaomojiInMRU(bool saveKaomojiInMRU) {
   setValue("saveKaomojiInMRU", saveKaomojiInMRU);
 }
 
+bool EmojiPickerSettings::fuzzySearch() const {
+  return value("fuzzySearch", true).toBool();
+}
+
+void EmojiPickerSettings::fuzzySearch(bool fuzzySearch) {
+  setValue("fuzzySearch", fuzzySearch);
+}
+
+int EmojiPickerSettings::releaseCachesAfterIdleSeconds() const {
+  return value("releaseCachesAfterIdleSeconds", 0).toInt();
+}
+
+void EmojiPickerSettings::releaseCachesAfterIdleSeconds(int releaseCachesAfterIdleSeconds) {
+  setValue("releaseCachesAfterIdleSeconds", releaseCachesAfterIdleSeconds);
+}
+
 std::unordered_map<char, QKeySequence> EmojiPickerSettings::customHotKeys() {
   std::unordered_map<char, QKeySequence> result;
 
@@ -254,29 +312,79 @@ EmojiPickerCache::~EmojiPickerCache() {
   setValue("version", QCoreApplication::applicationVersion());
 }
 
+QString EmojiPickerCache::directory() {
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+}
+
 QString EmojiPickerCache::path() {
-  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/cache.ini";
+  return directory() + "/cache.ini";
+}
+
+// `Emoji` only holds views so entries read from disk have to be resolved to the static tables
+Emoji findEmojiOrKaomojiByCode(const std::string& code) {
+  int emojiId = emojiIdByCode(code);
+  if (emojiId != -1) {
+    return emojis[emojiId];
+  }
+
+  for (const Kaomoji& kaomoji : kaomojis) {
+    if (kaomoji.text == code) {
+      return Emoji{kaomoji.name, kaomoji.text, -1};
+    }
+  }
+
+  return {};
 }
 
 std::vector<Emoji> EmojiPickerCache::emojiMRU() {
   auto prefix = "emojiMRU";
   auto handler = [](QSettings& settings) -> Emoji {
-    return {
-      settings.value("emojiKey").toString().toStdString(),
-      settings.value("emojiStr").toString().toStdString(),
-    };
+    return findEmojiOrKaomojiByCode(settings.value("emojiStr").toString().toStdString());
   };
 
   auto mru = readQSettingsArrayToStdVector<Emoji>(*this, prefix, handler);
+  mru.erase(std::remove(mru.begin(), mru.end(), Emoji{}), mru.end());
   return mru;
 }
 
 void EmojiPickerCache::emojiMRU(const std::vector<Emoji>& mru) {
   auto prefix = "emojiMRU";
   auto handler = [](QSettings& settings, const Emoji& emoji) -> void {
-    settings.setValue("emojiKey", QString::fromStdString(emoji.name));
-    settings.setValue("emojiStr", QString::fromStdString(emoji.code));
+    settings.setValue("emojiKey", QString::fromUtf8(emoji.name.data(), emoji.name.size()));
+    settings.setValue("emojiStr", QString::fromUtf8(emoji.code.data(), emoji.code.size()));
   };
 
   writeQSettingsArrayFromStdVector<Emoji>(*this, prefix, mru, handler);
 }
+
+std::vector<bool> EmojiPickerCache::emojiFontSupport(const QString& fontKey) {
+  if (value("emojiFontSupport/fontKey").toString() != fontKey) {
+    return {};
+  }
+
+  QByteArray bits = value("emojiFontSupport/emojis").toByteArray();
+
+  int emojisLength = sizeof(emojis) / sizeof(Emoji);
+  if (bits.size() != (emojisLength + 7) / 8) {
+    return {};
+  }
+
+  std::vector<bool> result(emojisLength, false);
+  for (int emojiId = 0; emojiId < emojisLength; emojiId++) {
+    result[emojiId] = (bits[emojiId / 8] >> (emojiId % 8)) & 1;
+  }
+
+  return result;
+}
+
+void EmojiPickerCache::emojiFontSupport(const QString& fontKey, const std::vector<bool>& emojiFontSupport) {
+  QByteArray bits((emojiFontSupport.size() + 7) / 8, '\0');
+  for (std::size_t emojiId = 0; emojiId < emojiFontSupport.size(); emojiId++) {
+    if (emojiFontSupport[emojiId]) {
+      bits[(int)(emojiId / 8)] = (char)(bits[(int)(emojiId / 8)] | (1 << (emojiId % 8)));
+    }
+  }
+
+  setValue("emojiFontSupport/fontKey", fontKey);
+  setValue("emojiFontSupport/emojis", bits);
+}
@@ -1,12 +1,22 @@
 #pragma once
 
 #include "emojis.hpp"
-#include <QFontMetrics>
+#include <QFont>
 #include <QSettings>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+// every setting `disabledEmojis` depends on
+struct EmojiFilter {
+  int maxEmojiVersion = -1;
+  unsigned char disabledFlags = 0;
+  bool checkFontSupport = false;
+
+  bool operator==(const EmojiFilter& other) const;
+  bool operator!=(const EmojiFilter& other) const;
+};
+
 class EmojiPickerSettings : public QSettings {
   Q_OBJECT
 
@@ -27,12 +37,16 @@ public:
   int maxEmojiVersion() const;
   void maxEmojiVersion(int maxEmojiVersion);
 
-  bool isDisabledEmoji(const Emoji& emoji, const QFontMetrics& fontMetrics);
+  EmojiFilter emojiFilter() const;
+
+  // one bit per emoji (index into `emojis`)
+  static std::vector<bool> disabledEmojis(const EmojiFilter& filter, const QFont& font);
 
   std::vector<std::string> emojiAliasFiles();
   void emojiAliasFiles(const std::vector<std::string>& emojiAliasFiles);
 
-  std::unordered_map<std::string, std::vector<QString>> emojiAliases();
+  // the aliases of every emoji (index into `emojis`)
+  std::vector<std::vector<QString>> emojiAliases();
 
   // std::string customQssFilePath() const;
   // void customQssFilePath(const std::string& customQssFilePath);
@@ -58,6 +72,12 @@ public:
   bool saveKaomojiInMRU() const;
   void saveKaomojiInMRU(bool saveKaomojiInMRU);
 
+  bool fuzzySearch() const;
+  void fuzzySearch(bool fuzzySearch);
+
+  int releaseCachesAfterIdleSeconds() const;
+  void releaseCachesAfterIdleSeconds(int releaseCachesAfterIdleSeconds);
+
   std::unordered_map<char, QKeySequence> customHotKeys();
   void customHotKeys(const std::unordered_map<char, QKeySequence>& customHotKeys);
 };
@@ -73,6 +93,12 @@ public:
   std::vector<Emoji> emojiMRU();
   void emojiMRU(const std::vector<Emoji>& emojiMRU);
 
+  // one bit per emoji (index into `emojis`), empty if it was stored for another `fontKey`
+  std::vector<bool> emojiFontSupport(const QString& fontKey);
+  void emojiFontSupport(const QString& fontKey, const std::vector<bool>& emojiFontSupport);
+
+  static QString directory();
+
 private:
   static QString path();
 };
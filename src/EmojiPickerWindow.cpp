@@ -1,7 +1,10 @@
 #include "EmojiPickerWindow.hpp"
+#include "EmojiAtlas.hpp"
+#include "EmojiGlyphCache.hpp"
 #include "EmojiLabel.hpp"
 #include "emojis.hpp"
 #include "kaomojis.hpp"
+#include "logging.hpp"
 #include <QApplication>
 #include <QClipboard>
 #include <QDesktopServices>
@@ -9,13 +12,16 @@
 #include <QFile>
 #include <QKeyEvent>
 #include <QScreen>
+#include <QSocketNotifier>
 #include <QStyle>
 #include <QTextStream>
 #include <QTimer>
 #include <algorithm>
-#include <condition_variable>
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <mutex>
+#include <optional>
+#include <sys/eventfd.h>
 #include <unistd.h>
 #include <vector>
 
@@ -76,7 +82,57 @@ void moveQWidgetToPoint(QWidget* window, QPoint newPoint) {
 std::function<void()> resetInputMethodEngine = []() {
 };
 
-ThreadsafeQueue<std::shared_ptr<EmojiCommand>> emojiCommandQueue;
+EmojiCommandQueue::EmojiCommandQueue() {
+  _fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
+
+EmojiCommandQueue::~EmojiCommandQueue() {
+  if (_fd != -1) {
+    close(_fd);
+  }
+}
+
+void EmojiCommandQueue::push(EmojiCommand&& command) {
+  if (!_commands.push(std::move(command))) {
+    log_printf("[warning] EmojiCommandQueue::push dropped a command, the queue is full\n");
+  }
+
+  wake();
+}
+
+bool EmojiCommandQueue::pop(EmojiCommand& command) {
+  return _commands.pop(command);
+}
+
+int EmojiCommandQueue::fd() const {
+  return _fd;
+}
+
+void EmojiCommandQueue::wake() {
+  // only adds to the counter, the Qt thread wakes up once for any number of writes
+  uint64_t value = 1;
+  [[maybe_unused]] ssize_t written = write(_fd, &value, sizeof(value));
+}
+
+void EmojiCommandQueue::acknowledge() {
+  // resets the counter, fails without blocking if nothing was signaled
+  uint64_t value;
+  [[maybe_unused]] ssize_t readLength = read(_fd, &value, sizeof(value));
+}
+
+EmojiCommandQueue emojiCommandQueue;
+
+EmojiCommandProcessKeyEvent::EmojiCommandProcessKeyEvent(const QKeyEvent& keyEvent, EmojiAction action) : type{keyEvent.type()}, key{keyEvent.key()}, modifiers{(int)keyEvent.modifiers()}, action{action} {
+  QString keyText = keyEvent.text().left(sizeof(text) / sizeof(char16_t));
+  textLength = keyText.size();
+  for (int i = 0; i < textLength; i++) {
+    text[i] = keyText.at(i).unicode();
+  }
+}
+
+QKeyEvent EmojiCommandProcessKeyEvent::toQKeyEvent() const {
+  return QKeyEvent(type, key, Qt::KeyboardModifiers(modifiers), QString::fromUtf16(text, textLength));
+}
 
 EmojiPickerWindow::EmojiPickerWindow() : QMainWindow() {
   setFocusPolicy(Qt::NoFocus);
@@ -106,17 +162,11 @@ EmojiPickerWindow::EmojiPickerWindow() : QMainWindow() {
   _searchContainerLayout->addWidget(_searchCompletion);
   _searchContainerLayout->addWidget(_searchEdit);
 
-  _emojiListWidget->setFocusPolicy(Qt::NoFocus);
-  _emojiListWidget->setLayout(_emojiListLayout);
-  _emojiListLayout->setContentsMargins(4, 4, 4, 4);
-  _emojiListLayout->setSizeConstraint(QLayout::SetMinAndMaxSize);
-  _emojiListLayout->setAlignment(Qt::AlignTop);
-
   _emojiListScroll->setFocusPolicy(Qt::NoFocus);
   _emojiListScroll->setWidgetResizable(true);
   _emojiListScroll->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
   _emojiListScroll->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-  _emojiListScroll->setWidget(_emojiListWidget);
+  _emojiListScroll->setWidget(_emojiGrid);
 
   _centralWidget->setFocusPolicy(Qt::NoFocus);
   _centralWidget->setLayout(_centralLayout);
@@ -127,11 +177,9 @@ EmojiPickerWindow::EmojiPickerWindow() : QMainWindow() {
 
   setCentralWidget(_centralWidget);
 
-  _mruModeLabel->setEmoji({"favorites", "⭐"}, 14, 14);
+  // the icons are set by the first `enable`, the window is created when the input method is loaded
   _mruModeLabel->setHighlighted(_mode == ViewMode::MRU);
-  _listModeLabel->setEmoji({"emoji list", "🗃"}, 14, 14);
   _listModeLabel->setHighlighted(_mode == ViewMode::LIST);
-  _kaomojiModeLabel->setEmoji({"kaomoji list", "ヽ(o^ ^o)ﾉ"}, 18, 18);
   _kaomojiModeLabel->setHighlighted(_mode == ViewMode::KAOMOJI);
 
   _statusBar->setFixedHeight(20);
@@ -141,21 +189,11 @@ EmojiPickerWindow::EmojiPickerWindow() : QMainWindow() {
 
   setStatusBar(_statusBar);
 
-  int emojisLength = sizeof(emojis) / sizeof(Emoji);
-  int kaomojisLength = sizeof(kaomojis) / sizeof(Kaomoji);
-  _emojiLayoutItems.reserve(emojisLength + kaomojisLength);
-
-  // dummyRow needs to be outside of the used range
-  int dummyRow = ((emojisLength + kaomojisLength) / _rowSize) + 1;
-  // add dummy labels so real labels keep their correct position to the left (NOT the same as Qt::AlignLeft)
-  for (int column = 0, row = dummyRow; row == dummyRow;) {
-    auto emojiLayoutItem = getEmojiLayoutItem(Emoji{"|DUMMY" + std::to_string(column), ""});
-    auto label = static_cast<EmojiLabel*>(emojiLayoutItem->widget());
-
-    label->show();
+  QObject::connect(_searchWorker, &EmojiSearchWorker::resultsReady, this, &EmojiPickerWindow::applySearchResults, Qt::QueuedConnection);
 
-    addItemToEmojiList(&*emojiLayoutItem, label, 1, row, column);
-  }
+  QObject::connect(_emojiGrid, &EmojiGrid::emojiPressed, [this](const Emoji& emoji, bool hasRealEmoji) {
+    commitEmoji(emoji, hasRealEmoji, _settings.closeAfterFirstInput());
+  });
 
   EmojiPickerSettings::writeDefaultsToDisk();
 }
@@ -178,82 +216,52 @@ void EmojiPickerWindow::wheelEvent(QWheelEvent* event) {
   }
 
   if (stepsDelta.y() > 0) {
-    moveSelectedEmojiLabel(-1, 0);
+    moveSelectedEmoji(-1, 0);
   } else {
-    moveSelectedEmojiLabel(1, 0);
+    moveSelectedEmoji(1, 0);
   }
 }
 
-EmojiLabel* EmojiPickerWindow::selectedEmojiLabel() {
-  QLayoutItem* item = _emojiListLayout->itemAtPosition(_selectedRow, _selectedColumn);
-  if (!item) {
-    return nullptr;
-  }
-
-  EmojiLabel* widget = static_cast<EmojiLabel*>(item->widget());
-  return widget;
+const EmojiGridItem* EmojiPickerWindow::selectedEmojiItem() {
+  return _emojiGrid->itemAt(_selectedRow, _selectedColumn);
 }
 
-void showEmojiRow(QGridLayout* _emojiListLayout, int row) {
-  for (int column = 0; column < _emojiListLayout->columnCount(); column++) {
-    QLayoutItem* emojiLayoutItem = _emojiListLayout->itemAtPosition(row, column);
-    if (!emojiLayoutItem) {
-      continue;
-    }
-
-    auto label = static_cast<EmojiLabel*>(emojiLayoutItem->widget());
-    label->show();
-  }
-}
-
-void EmojiPickerWindow::moveSelectedEmojiLabel(int row, int column) {
-  EmojiLabel* previousLabel = selectedEmojiLabel();
-
-  if (previousLabel) {
-    previousLabel->setHighlighted(false);
-  }
+void EmojiPickerWindow::moveSelectedEmoji(int row, int column) {
+  const EmojiGridItem* previousItem = selectedEmojiItem();
 
   _selectedRow += row;
   _selectedColumn += column;
 
-  EmojiLabel* nextLabel = selectedEmojiLabel();
+  const EmojiGridItem* nextItem = selectedEmojiItem();
 
   // the following is a piece of shit
   // basically kaomoji have a colspan of 2 which means:
   // moving left or right requires a 2 instead of 1
-  if (nextLabel == previousLabel) {
+  if (nextItem == previousItem) {
     _selectedRow += row;
     _selectedColumn += column;
 
-    nextLabel = selectedEmojiLabel();
+    nextItem = selectedEmojiItem();
   }
 
-  if (!nextLabel || nextLabel->emoji().code == "") {
+  if (!nextItem) {
     _selectedRow -= row;
     _selectedColumn -= column;
 
-    nextLabel = selectedEmojiLabel();
+    nextItem = selectedEmojiItem();
   }
 
-  if (nextLabel) {
-    nextLabel->setHighlighted(true);
-
-    if (row != 0) {
-      for (int x = _selectedRow; x < std::min(_selectedRow + 5, _emojiListLayout->rowCount()); x++) {
-        showEmojiRow(_emojiListLayout, x);
-      }
-      for (int x = _selectedRow; x >= std::max(_selectedRow - 5, 0); x--) {
-        showEmojiRow(_emojiListLayout, x);
-      }
-    }
+  if (nextItem) {
+    _emojiGrid->setSelectedItem(nextItem);
 
-    _emojiListScroll->ensureWidgetVisible(nextLabel);
+    QRect rect = _emojiGrid->itemRect(*nextItem);
+    _emojiListScroll->ensureVisible(rect.center().x(), rect.center().y(), rect.width(), rect.height());
 
     updateSearchCompletion();
   }
 }
 
-bool stringIncludes(const std::string& text, const std::string& search) {
+bool stringIncludes(std::string_view text, std::string_view search) {
   auto found = std::search(text.begin(), text.end(), search.begin(), search.end(), [](char c1, char c2) {
     return std::tolower(c1) == std::tolower(c2);
   });
@@ -265,23 +273,23 @@ bool stringIncludes(const std::string& text, const std::string& search) {
   }
 }
 
-bool EmojiPickerWindow::stringMatches(const QString& target, const QString& search, SearchMode mode) {
-  if (mode == SearchMode::AUTO) {
+bool EmojiPickerWindow::stringMatches(const QString& target, const QString& search, EmojiSearchMode mode) {
+  if (mode == EmojiSearchMode::AUTO) {
     if (search.length() < 3) {
-      mode = SearchMode::STARTS_WITH;
+      mode = EmojiSearchMode::STARTS_WITH;
     } else {
-      mode = SearchMode::CONTAINS;
+      mode = EmojiSearchMode::CONTAINS;
     }
   }
 
   switch (mode) {
-  case SearchMode::CONTAINS:
+  case EmojiSearchMode::CONTAINS:
     return target.contains(search, Qt::CaseInsensitive);
 
-  case SearchMode::STARTS_WITH:
+  case EmojiSearchMode::STARTS_WITH:
     return target.startsWith(search, Qt::CaseInsensitive);
 
-  case SearchMode::EQUALS:
+  case EmojiSearchMode::EQUALS:
     return QString::compare(target, search, Qt::CaseInsensitive) == 0;
 
   default:
@@ -289,7 +297,7 @@ bool EmojiPickerWindow::stringMatches(const QString& target, const QString& sear
   }
 }
 
-bool EmojiPickerWindow::emojiMatchesSearch(const Emoji& emoji, const QString& search, SearchMode mode, QString& found) {
+bool EmojiPickerWindow::emojiMatchesSearch(const Emoji& emoji, const QString& search, EmojiSearchMode mode, QString& found) {
   QString emojiName = tr(emoji.name.data());
 
   if (stringMatches(emojiName, search, mode)) {
@@ -297,7 +305,12 @@ bool EmojiPickerWindow::emojiMatchesSearch(const Emoji& emoji, const QString& se
     return true;
   }
 
-  for (const QString& alias : _emojiAliases[emoji.code]) {
+  int emojiId = emojiIdByCode(emoji.code);
+  if (emojiId == -1 || emojiId >= (int)_emojiAliases.size()) {
+    return false;
+  }
+
+  for (const QString& alias : _emojiAliases[emojiId]) {
     if (stringMatches(alias, search, mode)) {
       found = alias;
       return true;
@@ -307,7 +320,7 @@ bool EmojiPickerWindow::emojiMatchesSearch(const Emoji& emoji, const QString& se
   return false;
 }
 
-bool EmojiPickerWindow::emojiMatchesSearch(const Emoji& emoji, const QString& search, SearchMode mode) {
+bool EmojiPickerWindow::emojiMatchesSearch(const Emoji& emoji, const QString& search, EmojiSearchMode mode) {
   QString found;
 
   return emojiMatchesSearch(emoji, search, mode, found);
@@ -317,10 +330,10 @@ void EmojiPickerWindow::updateSearchCompletion() {
   QString search = _searchEdit->text();
 
   QString completion = "";
-  if (selectedEmojiLabel()) {
-    const Emoji& emoji = selectedEmojiLabel()->emoji();
+  if (selectedEmojiItem()) {
+    const Emoji& emoji = selectedEmojiItem()->emoji;
 
-    emojiMatchesSearch(emoji, search, SearchMode::AUTO, completion);
+    emojiMatchesSearch(emoji, search, EmojiSearchMode::AUTO, completion);
   }
 
   int indexOfSearch = std::max(completion.indexOf(search, 0, Qt::CaseInsensitive), 0);
@@ -339,159 +352,93 @@ void EmojiPickerWindow::updateSearchCompletion() {
   _searchCompletion->setText(completion);
 }
 
-void EmojiPickerWindow::addItemToEmojiList(QLayoutItem* emojiLayoutItem, EmojiLabel* label, int colspan, int& row, int& column) {
-  if (colspan == 0) {
-    if (label->hasRealEmoji()) {
-      colspan = 1;
-    } else {
-      colspan = 2;
-    }
-  }
-
-  if ((column + colspan) > _rowSize) {
-    column = 0;
-    row += 1;
-  }
-
-  _emojiListLayout->addItem(emojiLayoutItem, row, column, 1, colspan, Qt::AlignHCenter | Qt::AlignBaseline);
-
-  column += colspan;
-  if (column >= _rowSize) {
-    column = 0;
-    row += 1;
-  }
+void EmojiPickerWindow::beginEmojiListUpdate() {
+  _emojiGrid->beginUpdate();
 }
 
-QWidgetItem* EmojiPickerWindow::createEmojiLabel(const Emoji& emoji) {
-  auto existing = _emojiLayoutItems[emoji.code];
-  if (!existing) {
-    auto emojiLayoutWidget = new EmojiLabel(_emojiListWidget, _settings, emoji);
-    auto emojiLayoutItem = new QWidgetItemV2(emojiLayoutWidget);
+void EmojiPickerWindow::endEmojiListUpdate() {
+  _emojiGrid->endUpdate();
 
-    _emojiLayoutItems[emoji.code] = existing = emojiLayoutItem;
-    emojiLayoutWidget->hide();
+  _selectedRow = 0;
+  _selectedColumn = 0;
+  _emojiGrid->setSelectedItem(selectedEmojiItem());
 
-    QObject::connect(emojiLayoutWidget, &EmojiLabel::mousePressed, [this, emojiLayoutWidget]() {
-      commitEmoji(emojiLayoutWidget->emoji(), emojiLayoutWidget->hasRealEmoji(), _settings.closeAfterFirstInput());
-    });
-  }
+  _emojiListScroll->ensureVisible(0, 0);
 
-  return existing;
+  updateSearchCompletion();
 }
 
-QWidgetItem* EmojiPickerWindow::getEmojiLayoutItem(const Emoji& emoji) {
-  return createEmojiLabel(emoji);
+void EmojiPickerWindow::beginCommandBatch() {
+  _commandBatch = true;
 }
 
-QWidgetItem* EmojiPickerWindow::getKaomojiLayoutItem(const Kaomoji& kaomoji) {
-  return createEmojiLabel(convertKaomojiToEmoji(kaomoji));
+void EmojiPickerWindow::endCommandBatch() {
+  _commandBatch = false;
+  applyPendingEmojiListUpdate();
 }
 
-void EmojiPickerWindow::updateEmojiList() {
-  if (selectedEmojiLabel()) {
-    selectedEmojiLabel()->setHighlighted(false);
+void EmojiPickerWindow::applyPendingEmojiListUpdate() {
+  if (!_emojiListUpdatePending) {
+    return;
   }
 
-  int indexToDelete = 0;
-  QLayoutItem* itemToRemove;
-  while ((itemToRemove = _emojiListLayout->itemAt(indexToDelete))) {
-    auto label = static_cast<EmojiLabel*>(itemToRemove->widget());
-
-    if (label->emoji().name[0] == '|') {
-      indexToDelete += 1;
-      continue;
-    }
-
-    label->hide();
+  bool commandBatch = _commandBatch;
+  _commandBatch = false;
+  _emojiListUpdatePending = false;
+  updateEmojiList();
+  _commandBatch = commandBatch;
+}
 
-    _emojiListLayout->removeItem(itemToRemove);
+void EmojiPickerWindow::updateEmojiList() {
+  if (_commandBatch) {
+    _emojiListUpdatePending = true;
+    return;
   }
 
   QString search = _searchEdit->text();
   std::string searchAsStdString = search.toStdString();
 
-  int row = 0;
-  int column = 0;
+  // MRU falls through to LIST if search != "" so both are searched by the worker.
+  // the current list stays visible until `applySearchResults` replaces it
+  if (_mode != ViewMode::KAOMOJI && search != "") {
+    _searchGeneration = _searchWorker->search(searchAsStdString, _rowSize * 5, _settings.fuzzySearch());
+    return;
+  }
+
+  _searchWorker->cancel();
+  _searchGeneration = 0;
 
-  _emojiListLayout->setEnabled(false);
+  beginEmojiListUpdate();
 
   switch (_mode) {
   case ViewMode::MRU: {
-    if (search == "") {
-      for (const auto& emoji : _emojiMRU) {
-        auto emojiLayoutItem = getEmojiLayoutItem(emoji);
-        auto label = static_cast<EmojiLabel*>(emojiLayoutItem->widget());
-
-        label->show();
-
-        addItemToEmojiList(&*emojiLayoutItem, label, 0, row, column);
-      }
-      break;
+    for (const auto& emoji : _emojiMRU) {
+      _emojiGrid->addEmoji(emoji);
     }
-    // fallthrough to ViewMode::LIST if search != ""
+    break;
   }
 
   case ViewMode::LIST: {
-    std::unordered_set<std::string> addedEmojis; // std::string_view would be better
-    auto addEmojis = [&](SearchMode searchMode) {
-      for (const auto& emoji : emojis) {
-        if (addedEmojis.count(emoji.code) != 0) {
-          continue;
-        }
-
-        if (_disabledEmojis.count(emoji.code) != 0) {
-          continue;
-        }
-
-        if (search != "" && !emojiMatchesSearch(emoji, search, searchMode)) {
-          continue;
-        }
-
-        auto emojiLayoutItem = getEmojiLayoutItem(emoji);
-        auto label = static_cast<EmojiLabel*>(emojiLayoutItem->widget());
-
-        if (row <= 5) {
-          label->show();
-        }
-
-        addItemToEmojiList(&*emojiLayoutItem, label, 0, row, column);
-
-        addedEmojis.emplace(emoji.code);
-
-        if (search != "" && row >= 5) {
-          break;
-        }
+    int emojisLength = sizeof(emojis) / sizeof(Emoji);
+    for (int emojiId = 0; emojiId < emojisLength; emojiId++) {
+      if (_disabledEmojis[emojiId]) {
+        continue;
       }
-    };
 
-    if (search != "") {
-      addEmojis(SearchMode::EQUALS);
-      addEmojis(SearchMode::STARTS_WITH);
+      _emojiGrid->addEmoji(emojis[emojiId]);
     }
-    addEmojis(SearchMode::AUTO);
     break;
   }
 
   case ViewMode::KAOMOJI: {
     for (const auto& kaomoji : kaomojis) {
-      if (_disabledEmojis.count(kaomoji.text) != 0) {
-        continue;
-      }
-
       if (search != "" && !stringIncludes(kaomoji.name, searchAsStdString)) {
         continue;
       }
 
-      auto emojiLayoutItem = getKaomojiLayoutItem(kaomoji);
-      auto label = static_cast<EmojiLabel*>(emojiLayoutItem->widget());
-
-      if (row <= 6) {
-        label->show();
-      }
-
-      addItemToEmojiList(&*emojiLayoutItem, label, 0, row, column);
+      _emojiGrid->addEmoji(convertKaomojiToEmoji(kaomoji));
 
-      if (search != "" && row >= 5) {
+      if (search != "" && _emojiGrid->rowCount() > 5) {
         break;
       }
     }
@@ -499,15 +446,45 @@ void EmojiPickerWindow::updateEmojiList() {
   }
   }
 
-  _selectedRow = 0;
-  _selectedColumn = 0;
-  if (selectedEmojiLabel()) {
-    selectedEmojiLabel()->setHighlighted(true);
+  endEmojiListUpdate();
+}
+
+void EmojiPickerWindow::applySearchResults() {
+  if (_searchGeneration == 0) {
+    return;
   }
 
-  _emojiListLayout->setEnabled(true);
+  std::vector<int> results;
+  if (!_searchWorker->takeResults(_searchGeneration, results)) {
+    return;
+  }
 
-  updateSearchCompletion();
+  showSearchResults(results);
+}
+
+void EmojiPickerWindow::waitForSearchResults() {
+  if (_searchGeneration == 0) {
+    return;
+  }
+
+  std::vector<int> results;
+  if (!_searchWorker->waitForResults(_searchGeneration, results)) {
+    return;
+  }
+
+  showSearchResults(results);
+}
+
+void EmojiPickerWindow::showSearchResults(const std::vector<int>& results) {
+  _searchGeneration = 0;
+
+  beginEmojiListUpdate();
+
+  for (int emojiId : results) {
+    _emojiGrid->addEmoji(emojis[emojiId]);
+  }
+
+  endEmojiListUpdate();
 }
 
 void EmojiPickerWindow::reset() {
@@ -519,18 +496,44 @@ void EmojiPickerWindow::enable(bool resetPosition) {
     moveQWidgetToCenter(this);
   }
 
+  // registers the emoji atlas resource and decodes its pages, nothing a daemon that never shows the picker should pay for
+  if (!_statusBarIconsLoaded) {
+    _statusBarIconsLoaded = true;
+
+    _mruModeLabel->setEmoji({"favorites", "⭐"}, 14, 14);
+    _listModeLabel->setEmoji({"emoji list", "🗃"}, 14, 14);
+    _kaomojiModeLabel->setEmoji({"kaomoji list", "ヽ(o^ ^o)ﾉ"}, 18, 18);
+  }
+
   show();
 
   _settings.sync();
 
-  _disabledEmojis.clear();
-  for (const Emoji& emoji : emojis) {
-    if (_settings.isDisabledEmoji(emoji, fontMetrics())) {
-      _disabledEmojis.insert(emoji.code);
-    }
+  // the font only matters if its support for every emoji is checked
+  EmojiFilter disabledEmojisFilter = _settings.emojiFilter();
+  QString disabledEmojisFontKey = disabledEmojisFilter.checkFontSupport ? font().key() : QString();
+  if (_disabledEmojis.empty() || disabledEmojisFilter != _disabledEmojisFilter || disabledEmojisFontKey != _disabledEmojisFontKey) {
+    _disabledEmojisFilter = disabledEmojisFilter;
+    _disabledEmojisFontKey = disabledEmojisFontKey;
+    _disabledEmojis = EmojiPickerSettings::disabledEmojis(_disabledEmojisFilter, font());
+
+    _searchWorker->setDisabledEmojis(_disabledEmojis);
   }
 
-  _emojiAliases = _settings.emojiAliases();
+  auto emojiAliases = _settings.emojiAliases();
+  if (!_emojiAliasesLoaded || emojiAliases != _emojiAliases) {
+    _emojiAliases = std::move(emojiAliases);
+    _emojiAliasesLoaded = true;
+
+    std::vector<std::vector<std::string>> aliasesById(_emojiAliases.size());
+    for (std::size_t emojiId = 0; emojiId < _emojiAliases.size(); emojiId++) {
+      for (const QString& alias : _emojiAliases[emojiId]) {
+        aliasesById[emojiId].push_back(alias.toStdString());
+      }
+    }
+
+    _searchWorker->setAliases(std::move(aliasesById));
+  }
 
   _emojiMRU = EmojiPickerCache{}.emojiMRU();
 
@@ -582,7 +585,7 @@ void EmojiPickerWindow::setCursorLocation(const QRect* rect) {
   move(newPoint);
 }
 
-QKeyEvent* createKeyEventWithUserPreferences(QEvent::Type _type, int _key, Qt::KeyboardModifiers _modifiers, const QString& _text) {
+QKeyEvent createKeyEventWithUserPreferences(QEvent::Type _type, int _key, Qt::KeyboardModifiers _modifiers, const QString& _text) {
   static std::unordered_map<char, QKeySequence> customHotKeys; // lazy
   static bool customHotKeysLoaded = false;
   if (!customHotKeysLoaded) {
@@ -617,7 +620,7 @@ QKeyEvent* createKeyEventWithUserPreferences(QEvent::Type _type, int _key, Qt::K
     }
   }
 
-  return new QKeyEvent(_type, _key, _modifiers, _text);
+  return QKeyEvent(_type, _key, _modifiers, _text);
 }
 
 EmojiAction getEmojiActionForQKeyEvent(const QKeyEvent* event) {
@@ -717,7 +720,7 @@ EmojiAction getEmojiActionForQKeyEvent(const QKeyEvent* event) {
 }
 
 void EmojiPickerWindow::commitEmoji(const Emoji& emoji, bool isRealEmoji, bool closeAfter) {
-  commitText(emoji.code);
+  commitText(std::string{emoji.code});
 
   if (isRealEmoji || _settings.saveKaomojiInMRU()) {
     _emojiMRU.erase(std::remove(_emojiMRU.begin(), _emojiMRU.end(), emoji), _emojiMRU.end());
@@ -737,6 +740,20 @@ void EmojiPickerWindow::processKeyEvent(const QKeyEvent* event, EmojiAction acti
     action = getEmojiActionForQKeyEvent(event);
   }
 
+  // only the actions that edit the search are merged into one update, the others see the list of the keys before them.
+  // that includes a search still running on the worker, "thu" + enter commits the first result for "thu"
+  switch (action) {
+  case EmojiAction::CUT_SELECTION_IN_SEARCH:
+  case EmojiAction::CLEAR_SEARCH:
+  case EmojiAction::REMOVE_CHAR_IN_SEARCH:
+  case EmojiAction::INSERT_CHAR_IN_SEARCH:
+    break;
+  default:
+    applyPendingEmojiListUpdate();
+    waitForSearchResults();
+    break;
+  }
+
   switch (action) {
   case EmojiAction::INVALID:
     break;
@@ -746,11 +763,10 @@ void EmojiPickerWindow::processKeyEvent(const QKeyEvent* event, EmojiAction acti
     break;
 
   case EmojiAction::COPY_SELECTED_EMOJI:
-    if (selectedEmojiLabel()) {
-      const EmojiLabel* label = selectedEmojiLabel();
-      const Emoji& emoji = label->emoji();
+    if (selectedEmojiItem()) {
+      const Emoji& emoji = selectedEmojiItem()->emoji;
 
-      QApplication::clipboard()->setText(QString::fromStdString(emoji.code));
+      QApplication::clipboard()->setText(QString::fromUtf8(emoji.code.data(), emoji.code.size()));
     }
     break;
 
@@ -759,10 +775,12 @@ void EmojiPickerWindow::processKeyEvent(const QKeyEvent* event, EmojiAction acti
     break;
 
   case EmojiAction::COMMIT_EMOJI:
-    if (selectedEmojiLabel()) {
+    if (selectedEmojiItem()) {
       bool closeAfter = (((event->modifiers() & Qt::ShiftModifier) && !_settings.closeAfterFirstInput()) || (!(event->modifiers() & Qt::ShiftModifier) && _settings.closeAfterFirstInput()));
 
-      commitEmoji(selectedEmojiLabel()->emoji(), selectedEmojiLabel()->hasRealEmoji(), closeAfter);
+      // copied since committing changes the list
+      EmojiGridItem item = *selectedEmojiItem();
+      commitEmoji(item.emoji, item.hasRealEmoji, closeAfter);
     }
     break;
 
@@ -799,27 +817,27 @@ void EmojiPickerWindow::processKeyEvent(const QKeyEvent* event, EmojiAction acti
     break;
 
   case EmojiAction::UP:
-    moveSelectedEmojiLabel(-1, 0);
+    moveSelectedEmoji(-1, 0);
     break;
 
   case EmojiAction::DOWN:
-    moveSelectedEmojiLabel(1, 0);
+    moveSelectedEmoji(1, 0);
     break;
 
   case EmojiAction::LEFT:
-    moveSelectedEmojiLabel(0, -1);
+    moveSelectedEmoji(0, -1);
     break;
 
   case EmojiAction::RIGHT:
-    moveSelectedEmojiLabel(0, 1);
+    moveSelectedEmoji(0, 1);
     break;
 
   case EmojiAction::PAGE_UP:
-    moveSelectedEmojiLabel(-4, 0);
+    moveSelectedEmoji(-4, 0);
     break;
 
   case EmojiAction::PAGE_DOWN:
-    moveSelectedEmojiLabel(4, 0);
+    moveSelectedEmoji(4, 0);
     break;
 
   case EmojiAction::OPEN_SETTINGS:
@@ -881,21 +899,90 @@ void loadScaleFactorFromSettings() {
   }
 }
 
-static std::mutex gui_mutex;
-static std::condition_variable gui_condition;
-static bool gui_is_active = false;
+struct EmojiCommandProcessor {
+  EmojiPickerWindow& window;
 
-void gui_set_active(bool active) {
-  if (!active) {
-    // give Qt time to actually close the window before the Qt main thread is blocked
-    // (assuming 'EmojiCommandDisable' has been dispatched beforehand)
-    usleep(1000 /*us*/ * 128 /*ms*/);
+  // only the newest one is applied, some applications report their cursor on every repaint
+  std::optional<QRect> cursorLocation;
+
+  void operator()(const EmojiCommandEnable& command) {
+    // the window is shown at the cursor instead of being moved there afterwards
+    applyCursorLocation();
+
+    window.commitText = command.commitText;
+    window.enable(command.resetPosition);
+  }
+
+  void operator()(const EmojiCommandDisable& command) {
+    window.disable();
+  }
+
+  void operator()(const EmojiCommandReset& command) {
+    window.reset();
   }
 
-  std::unique_lock<decltype(gui_mutex)> lock{gui_mutex};
+  void operator()(const EmojiCommandSetCursorLocation& command) {
+    cursorLocation = command.rect;
+  }
+
+  void operator()(const EmojiCommandProcessKeyEvent& command) {
+    QKeyEvent keyEvent = command.toQKeyEvent();
+    window.processKeyEvent(&keyEvent, command.action);
+  }
+
+  void applyCursorLocation() {
+    if (cursorLocation) {
+      window.setCursorLocation(&*cursorLocation);
+      cursorLocation.reset();
+    }
+  }
+
+  void finish() {
+    applyCursorLocation();
+  }
+};
+
+// the Qt thread is never blocked, while inactive its event loop just has nothing to do:
+// ACTIVE = the picker is open, WARM = it was closed but keeps its caches, IDLE = the caches were released (or never filled)
+enum class GuiState {
+  IDLE,
+  WARM,
+  ACTIVE,
+};
+
+static std::atomic<bool> gui_is_active{false};
+
+// never blocks the caller (the fcitx5 main loop or a signal handler), the Qt thread picks it up on its next wakeup
+void gui_set_active(bool active) {
   gui_is_active = active;
-  lock.unlock();
-  gui_condition.notify_one();
+
+  // there may be no command that wakes the Qt thread up
+  emojiCommandQueue.wake();
+}
+
+static void gui_release_caches() {
+  log_printf("[debug] gui_release_caches\n");
+
+  clearEmojiGlyphCache();
+  clearEmojiGlowSprites();
+  releaseEmojiAtlas();
+}
+
+static void gui_update_state(GuiState& state, QTimer& idleTimer, const EmojiPickerWindow& window) {
+  // ibus never deactivates, it only hides the window
+  bool active = gui_is_active && window.isVisible();
+
+  if (active && state != GuiState::ACTIVE) {
+    idleTimer.stop();
+    state = GuiState::ACTIVE;
+  } else if (!active && state == GuiState::ACTIVE) {
+    state = GuiState::WARM;
+
+    int idleSeconds = EmojiPickerSettings{}.releaseCachesAfterIdleSeconds();
+    if (idleSeconds > 0) {
+      idleTimer.start(idleSeconds * 1000);
+    }
+  }
 }
 
 void gui_main(int argc, char** argv) {
@@ -917,40 +1004,40 @@ void gui_main(int argc, char** argv) {
 
   EmojiPickerWindow window;
 
-  QTimer commandProcessor;
-  commandProcessor.start(32 /*ms*/);
-  QObject::connect(&commandProcessor, &QTimer::timeout, [&commandProcessor, &window]() {
-    // block the entire Qt main thread if gui_is_active == false
-    std::unique_lock<decltype(gui_mutex)> lock{gui_mutex};
-    gui_condition.wait(lock, []() {
-      return gui_is_active;
-    });
-    lock.unlock();
-
-    std::shared_ptr<EmojiCommand> _command;
-    if (emojiCommandQueue.pop(_command)) {
-      if (auto command = std::dynamic_pointer_cast<EmojiCommandEnable>(_command)) {
-        window.commitText = command->commitText;
-        window.enable(command->resetPosition);
-
-        commandProcessor.setInterval(4 /*ms*/);
-      }
-      if (auto command = std::dynamic_pointer_cast<EmojiCommandDisable>(_command)) {
-        window.disable();
+  GuiState state = GuiState::IDLE;
 
-        commandProcessor.setInterval(32 /*ms*/);
-      }
-      if (auto command = std::dynamic_pointer_cast<EmojiCommandReset>(_command)) {
-        window.reset();
-      }
-      if (auto command = std::dynamic_pointer_cast<EmojiCommandSetCursorLocation>(_command)) {
-        window.setCursorLocation(&*command->rect);
-      }
-      if (auto command = std::dynamic_pointer_cast<EmojiCommandProcessKeyEvent>(_command)) {
-        window.processKeyEvent(&*command->keyEvent, command->action);
-      }
+  // the only timer, it is running while the state is WARM
+  QTimer idleTimer;
+  idleTimer.setSingleShot(true);
+  QObject::connect(&idleTimer, &QTimer::timeout, [&state]() {
+    gui_release_caches();
+    state = GuiState::IDLE;
+  });
+
+  // the event loop sleeps until a command is pushed (or `gui_set_active` is called)
+  QSocketNotifier commandNotifier{emojiCommandQueue.fd(), QSocketNotifier::Read};
+  QObject::connect(&commandNotifier, &QSocketNotifier::activated, [&window, &state, &idleTimer]() {
+    // before popping, a command pushed in the meantime signals the eventfd again
+    emojiCommandQueue.acknowledge();
+
+    // everything that is pending is processed at once, a burst of keys results in a single search and repaint
+    EmojiCommandProcessor processor{window};
+    window.beginCommandBatch();
+
+    EmojiCommand command;
+    while (emojiCommandQueue.pop(command)) {
+      std::visit(processor, command);
     }
+
+    processor.finish();
+    window.endCommandBatch();
+
+    gui_update_state(state, idleTimer, window);
   });
 
   app.exec();
+
+  // the cached pixmaps are static and would outlive the application otherwise
+  clearEmojiGlyphCache();
+  clearEmojiGlowSprites();
 }
@@ -1,13 +1,15 @@
 #pragma once
 
+#include "EmojiGrid.hpp"
 #include "EmojiLabel.hpp"
 #include "EmojiPickerSettings.hpp"
-#include "ThreadsafeQueue.hpp"
+#include "EmojiSearchWorker.hpp"
+#include "MpscRingBuffer.hpp"
 #include "kaomojis.hpp"
-#include <QGridLayout>
 #include <QKeyEvent>
 #include <QLineEdit>
 #include <QMainWindow>
+#include <QRect>
 #include <QScrollArea>
 #include <QStackedLayout>
 #include <QStatusBar>
@@ -16,8 +18,8 @@
 #include <functional>
 #include <memory>
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 extern std::function<void()> resetInputMethodEngine;
@@ -42,55 +44,73 @@ enum class EmojiAction {
   INSERT_CHAR_IN_SEARCH,
 };
 
-struct EmojiCommand {
-public:
-  virtual ~EmojiCommand() {
-  }
-};
-
-struct EmojiCommandEnable : public EmojiCommand {
+struct EmojiCommandEnable {
 public:
+  // pushed once per activation, the only command that is not trivially copyable
   std::function<void(const std::string&)> commitText;
 
-  bool resetPosition;
+  bool resetPosition = true;
+};
 
-  EmojiCommandEnable(std::function<void(const std::string&)>&& commitText, bool resetPosition = true) : EmojiCommand(), commitText{std::move(commitText)}, resetPosition{resetPosition} {
-  }
+struct EmojiCommandDisable {
 };
 
-struct EmojiCommandDisable : public EmojiCommand {
-public:
-  EmojiCommandDisable() : EmojiCommand() {
-  }
+struct EmojiCommandReset {
 };
 
-struct EmojiCommandReset : public EmojiCommand {
+struct EmojiCommandSetCursorLocation {
 public:
-  EmojiCommandReset() : EmojiCommand() {
-  }
+  QRect rect;
 };
 
-struct EmojiCommandSetCursorLocation : public EmojiCommand {
+// the key event is rebuilt by the Qt thread, so pushing one copies a few ints instead of allocating a QKeyEvent
+struct EmojiCommandProcessKeyEvent {
 public:
-  std::shared_ptr<QRect> rect;
+  QEvent::Type type = QEvent::KeyPress;
+  int key = 0;
+  int modifiers = Qt::NoModifier;
+  // utf-16, a key produces a single character (or a surrogate pair)
+  char16_t text[4] = {};
+  int textLength = 0;
 
-  EmojiCommandSetCursorLocation(QRect* rect) : EmojiCommand(), rect{rect} {
-  }
+  EmojiAction action = EmojiAction::INVALID;
+
+  EmojiCommandProcessKeyEvent(const QKeyEvent& keyEvent, EmojiAction action = EmojiAction::INVALID);
+
+  QKeyEvent toQKeyEvent() const;
 };
 
-struct EmojiCommandProcessKeyEvent : public EmojiCommand {
+static_assert(std::is_trivially_copyable_v<EmojiCommandSetCursorLocation>);
+static_assert(std::is_trivially_copyable_v<EmojiCommandProcessKeyEvent>);
+
+using EmojiCommand = std::variant<EmojiCommandEnable, EmojiCommandDisable, EmojiCommandReset, EmojiCommandSetCursorLocation, EmojiCommandProcessKeyEvent>;
+
+// the input method callbacks push the commands, the Qt thread pops them.
+// with fcitx5 both threads push: the fcitx5 main loop and the Qt thread itself (`disable` deactivates the module through `resetInputMethodEngine`).
+// every push signals an eventfd which the Qt thread watches, so it sleeps while there is nothing to do
+class EmojiCommandQueue {
 public:
-  std::shared_ptr<QKeyEvent> keyEvent;
+  EmojiCommandQueue();
+  ~EmojiCommandQueue();
+
+  // drops the command if the Qt thread is that far behind
+  void push(EmojiCommand&& command);
+  bool pop(EmojiCommand& command);
 
-  EmojiAction action;
+  // readable while the Qt thread has to be woken up
+  int fd() const;
+  void wake();
+  // called by the Qt thread before it pops the pending commands
+  void acknowledge();
 
-  EmojiCommandProcessKeyEvent(QKeyEvent* keyEvent, EmojiAction action = EmojiAction::INVALID) : EmojiCommand(), keyEvent{keyEvent}, action{action} {
-  }
+private:
+  MpscRingBuffer<EmojiCommand, 256> _commands;
+  int _fd = -1;
 };
 
-extern ThreadsafeQueue<std::shared_ptr<EmojiCommand>> emojiCommandQueue;
+extern EmojiCommandQueue emojiCommandQueue;
 
-QKeyEvent* createKeyEventWithUserPreferences(QEvent::Type _type, int _key, Qt::KeyboardModifiers _modifiers, const QString& _text);
+QKeyEvent createKeyEventWithUserPreferences(QEvent::Type _type, int _key, Qt::KeyboardModifiers _modifiers, const QString& _text);
 
 EmojiAction getEmojiActionForQKeyEvent(const QKeyEvent* event);
 
@@ -109,6 +129,11 @@ public:
   void updateSearchCompletion();
   void updateEmojiList();
 
+  // the commands pushed since the last wakeup are processed as one batch.
+  // the emoji list is updated once at its end, so a burst of typed characters searches only once
+  void beginCommandBatch();
+  void endCommandBatch();
+
 public Q_SLOTS:
   void reset();
   void enable(bool resetPosition = true);
@@ -116,6 +141,14 @@ public Q_SLOTS:
   void setCursorLocation(const QRect* rect);
   void processKeyEvent(const QKeyEvent* event, EmojiAction action = EmojiAction::INVALID);
 
+private Q_SLOTS:
+  void applySearchResults();
+
+private:
+  // the actions that read the emoji list must not see the results of an older search
+  void waitForSearchResults();
+  void showSearchResults(const std::vector<int>& results);
+
 protected:
   void changeEvent(QEvent* event) override;
 
@@ -126,16 +159,10 @@ private:
 
   EmojiPickerSettings _settings;
 
-  std::unordered_map<std::string, QWidgetItem*> _emojiLayoutItems;
-  QWidgetItem* createEmojiLabel(const Emoji& emoji);
-
-  QWidgetItem* getEmojiLayoutItem(const Emoji& emoji);
-  QWidgetItem* getKaomojiLayoutItem(const Kaomoji& kaomoji);
-
   int _selectedRow = 0;
   int _selectedColumn = 0;
-  EmojiLabel* selectedEmojiLabel();
-  void moveSelectedEmojiLabel(int row, int col);
+  const EmojiGridItem* selectedEmojiItem();
+  void moveSelectedEmoji(int row, int col);
 
   QWidget* _centralWidget = new QWidget(this);
   QVBoxLayout* _centralLayout = new QVBoxLayout(_centralWidget);
@@ -146,31 +173,35 @@ private:
   QLineEdit* _searchCompletion = new QLineEdit(_searchContainerWidget);
 
   QScrollArea* _emojiListScroll = new QScrollArea(_centralWidget);
-  QWidget* _emojiListWidget = new QWidget(_emojiListScroll);
-  QGridLayout* _emojiListLayout = new QGridLayout(_emojiListWidget);
+  EmojiGrid* _emojiGrid = new EmojiGrid(_emojiListScroll, _settings, _rowSize);
 
   QStatusBar* _statusBar = new QStatusBar(this);
   EmojiLabel* _mruModeLabel = new EmojiLabel(_statusBar, _settings);
   EmojiLabel* _listModeLabel = new EmojiLabel(_statusBar, _settings);
   EmojiLabel* _kaomojiModeLabel = new EmojiLabel(_statusBar, _settings);
+  bool _statusBarIconsLoaded = false;
 
-  void addItemToEmojiList(QLayoutItem* emojiLayoutItem, EmojiLabel* label, int colspan, int& row, int& column);
+  void beginEmojiListUpdate();
+  void endEmojiListUpdate();
 
-  enum class SearchMode {
-    AUTO,
-    CONTAINS,
-    STARTS_WITH,
-    EQUALS,
-  };
+  bool _commandBatch = false;
+  bool _emojiListUpdatePending = false;
+  void applyPendingEmojiListUpdate();
+
+  static bool stringMatches(const QString& target, const QString& search, EmojiSearchMode mode);
 
-  static bool stringMatches(const QString& target, const QString& search, SearchMode mode);
+  bool emojiMatchesSearch(const Emoji& emoji, const QString& search, EmojiSearchMode mode, QString& found);
+  bool emojiMatchesSearch(const Emoji& emoji, const QString& search, EmojiSearchMode mode);
 
-  bool emojiMatchesSearch(const Emoji& emoji, const QString& search, SearchMode mode, QString& found);
-  bool emojiMatchesSearch(const Emoji& emoji, const QString& search, SearchMode mode);
+  std::vector<bool> _disabledEmojis;
+  EmojiFilter _disabledEmojisFilter;
+  QString _disabledEmojisFontKey;
 
-  std::unordered_set<std::string> _disabledEmojis;
+  std::vector<std::vector<QString>> _emojiAliases;
+  bool _emojiAliasesLoaded = false;
 
-  std::unordered_map<std::string, std::vector<QString>> _emojiAliases;
+  EmojiSearchWorker* _searchWorker = new EmojiSearchWorker(this);
+  quint64 _searchGeneration = 0;
 
   std::vector<Emoji> _emojiMRU;
 
@@ -0,0 +1,319 @@
+#include "EmojiSearch.hpp"
+#include "emojis.hpp"
+#include <QString>
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+void EmojiSearchIndex::build(const std::vector<std::vector<std::string>>& aliasesById) {
+  _keyData.clear();
+  _keys.clear();
+  _suffixes.clear();
+
+  int emojisLength = sizeof(emojis) / sizeof(Emoji);
+  for (int emojiId = 0; emojiId < emojisLength; emojiId++) {
+    const Emoji& emoji = emojis[emojiId];
+
+    addKey(emoji.name, emojiId, false);
+
+    if (emojiId >= (int)aliasesById.size()) {
+      continue;
+    }
+
+    for (const std::string& alias : aliasesById[emojiId]) {
+      addKey(alias, emojiId, true);
+    }
+  }
+
+  for (const Key& key : _keys) {
+    for (unsigned int i = 0; i < key.length; i++) {
+      // only start suffixes at the first byte of an utf8 sequence
+      if ((_keyData[key.offset + i] & 0xC0) == 0x80) {
+        continue;
+      }
+
+      _suffixes.push_back(key.offset + i);
+    }
+  }
+
+  const char* keyData = _keyData.data();
+  std::sort(_suffixes.begin(), _suffixes.end(), [keyData](unsigned int a, unsigned int b) {
+    return std::strcmp(keyData + a, keyData + b) < 0;
+  });
+}
+
+bool EmojiSearchIndex::empty() const {
+  return _keys.empty();
+}
+
+EmojiSearchIndex::Range EmojiSearchIndex::suffixes() const {
+  return {0, (unsigned int)_suffixes.size()};
+}
+
+EmojiSearchIndex::Range EmojiSearchIndex::findSuffixes(std::string_view foldedSearch, Range within) const {
+  const char* keyData = _keyData.data();
+
+  auto first = _suffixes.begin() + within.begin;
+  auto last = _suffixes.begin() + within.end;
+
+  auto begin = std::lower_bound(first, last, foldedSearch, [keyData](unsigned int suffix, std::string_view search) {
+    return std::strncmp(keyData + suffix, search.data(), search.length()) < 0;
+  });
+  auto end = std::upper_bound(begin, last, foldedSearch, [keyData](std::string_view search, unsigned int suffix) {
+    return std::strncmp(search.data(), keyData + suffix, search.length()) < 0;
+  });
+
+  return {(unsigned int)(begin - _suffixes.begin()), (unsigned int)(end - _suffixes.begin())};
+}
+
+std::vector<int> EmojiSearchIndex::rank(std::string_view foldedSearch, Range range, std::size_t limit, bool fuzzy, const std::function<bool(int)>& isDisabled) const {
+  if (foldedSearch.empty() || limit == 0) {
+    return {};
+  }
+
+  bool allowSubstrings = foldedSearch.length() >= 3;
+
+  // best match per emoji so every emoji is ranked by its best matching name or alias
+  std::vector<Match> matches(sizeof(emojis) / sizeof(Emoji));
+  std::vector<int> candidates;
+
+  for (unsigned int i = range.begin; i < range.end; i++) {
+    unsigned int suffix = _suffixes[i];
+    const Key& key = keyAt(suffix);
+
+    if (suffix != key.offset && !allowSubstrings) {
+      continue;
+    }
+
+    EmojiSearchScore score = scoreMatch(key, suffix, foldedSearch.length());
+
+    Match& bestMatch = matches[key.emojiId];
+    if (bestMatch.score == EmojiSearchScore::NONE) {
+      candidates.push_back(key.emojiId);
+    }
+    if (score < bestMatch.score) {
+      bestMatch = {score};
+    }
+  }
+
+  // the bit-parallel matcher keeps one bit per search character.
+  // with less than 4 characters a single typo already matches nearly every key
+  if (fuzzy && foldedSearch.length() >= 4 && foldedSearch.length() < 64) {
+    unsigned long long searchMasks[256] = {};
+    for (std::size_t i = 0; i < foldedSearch.length(); i++) {
+      searchMasks[(unsigned char)foldedSearch[i]] |= 1ull << i;
+    }
+
+    for (const Key& key : _keys) {
+      Match& bestMatch = matches[key.emojiId];
+      if (bestMatch.score < EmojiSearchScore::TYPO_1_NAME) {
+        continue;
+      }
+
+      Match match = scoreFuzzyMatch(key, foldedSearch, searchMasks);
+      if (match.score == EmojiSearchScore::NONE) {
+        continue;
+      }
+
+      if (bestMatch.score == EmojiSearchScore::NONE) {
+        candidates.push_back(key.emojiId);
+      }
+      if (match < bestMatch) {
+        bestMatch = match;
+      }
+    }
+  }
+
+  auto isBetter = [&matches](int a, int b) {
+    if (matches[a] < matches[b]) {
+      return true;
+    }
+    if (matches[b] < matches[a]) {
+      return false;
+    }
+    return a < b;
+  };
+
+  // bounded max-heap: the worst of the current top `limit` sits at the front
+  std::vector<int> heap;
+  heap.reserve(limit + 1);
+  for (int emojiId : candidates) {
+    if (isDisabled(emojiId)) {
+      continue;
+    }
+
+    if (heap.size() == limit && !isBetter(emojiId, heap.front())) {
+      continue;
+    }
+
+    heap.push_back(emojiId);
+    std::push_heap(heap.begin(), heap.end(), isBetter);
+
+    if (heap.size() > limit) {
+      std::pop_heap(heap.begin(), heap.end(), isBetter);
+      heap.pop_back();
+    }
+  }
+
+  std::sort_heap(heap.begin(), heap.end(), isBetter);
+
+  return heap;
+}
+
+std::string EmojiSearchIndex::foldCase(std::string_view text) {
+  bool isAscii = std::all_of(text.begin(), text.end(), [](char c) {
+    return (unsigned char)c < 0x80;
+  });
+
+  // names like flag_türkiye and user defined aliases aren't ascii, they are lowered like QString::toLower always did
+  if (!isAscii) {
+    return QString::fromUtf8(text.data(), text.size()).toLower().toStdString();
+  }
+
+  // almost every key and search, without the utf-16 round trip
+  std::string result{text};
+  for (char& c : result) {
+    if (c >= 'A' && c <= 'Z') {
+      c = c - 'A' + 'a';
+    }
+  }
+
+  return result;
+}
+
+void EmojiSearchIndex::addKey(std::string_view text, int emojiId, bool isAlias) {
+  std::string foldedText = foldCase(text);
+  if (foldedText.empty()) {
+    return;
+  }
+
+  _keys.push_back({(unsigned int)_keyData.length(), (unsigned int)foldedText.length(), emojiId, isAlias});
+
+  _keyData += foldedText;
+  _keyData += '\0';
+}
+
+bool EmojiSearchIndex::Match::operator<(const Match& other) const {
+  return std::tie(score, distance, position, length) < std::tie(other.score, other.distance, other.position, other.length);
+}
+
+const EmojiSearchIndex::Key& EmojiSearchIndex::keyAt(unsigned int offset) const {
+  auto key = std::upper_bound(_keys.begin(), _keys.end(), offset, [](unsigned int offset, const Key& key) {
+    return offset < key.offset;
+  });
+
+  return *(key - 1);
+}
+
+EmojiSearchScore EmojiSearchIndex::scoreMatch(const Key& key, unsigned int suffix, std::size_t searchLength) const {
+  if (suffix == key.offset) {
+    if (key.length == searchLength) {
+      return key.isAlias ? EmojiSearchScore::EXACT_ALIAS : EmojiSearchScore::EXACT_NAME;
+    }
+
+    return key.isAlias ? EmojiSearchScore::PREFIX_ALIAS : EmojiSearchScore::PREFIX_NAME;
+  }
+
+  switch (_keyData[suffix - 1]) {
+  case '_':
+  case ' ':
+  case '-':
+  case ':':
+    return key.isAlias ? EmojiSearchScore::WORD_PREFIX_ALIAS : EmojiSearchScore::WORD_PREFIX_NAME;
+  }
+
+  return key.isAlias ? EmojiSearchScore::SUBSTRING_ALIAS : EmojiSearchScore::SUBSTRING_NAME;
+}
+
+// shift-and with errors (wu-manber): `matches[d]` has bit i set if the first i + 1 characters of the search
+// end at the current text position with at most d edits
+EmojiSearchIndex::Match EmojiSearchIndex::scoreFuzzyMatch(const Key& key, std::string_view foldedSearch, const unsigned long long* searchMasks) const {
+  const char* text = _keyData.data() + key.offset;
+
+  int maxDistance = foldedSearch.length() < 6 ? 1 : 2;
+  unsigned long long found = 1ull << (foldedSearch.length() - 1);
+
+  unsigned long long matches[3] = {0, 1, 3};
+  int distance = maxDistance + 1;
+  unsigned int position = 0;
+
+  for (unsigned int i = 0; i < key.length; i++) {
+    unsigned long long mask = searchMasks[(unsigned char)text[i]];
+
+    unsigned long long previous = matches[0];
+    matches[0] = ((matches[0] << 1) | 1) & mask;
+
+    for (int d = 1; d <= maxDistance; d++) {
+      unsigned long long current = matches[d];
+      matches[d] = (((current << 1) | 1) & mask) | previous | ((previous | matches[d - 1]) << 1) | 1;
+      previous = current;
+    }
+
+    for (int d = 0; d < distance; d++) {
+      if (matches[d] & found) {
+        distance = d;
+        position = i;
+        break;
+      }
+    }
+  }
+
+  if (distance <= 1) {
+    return {key.isAlias ? EmojiSearchScore::TYPO_1_ALIAS : EmojiSearchScore::TYPO_1_NAME, distance, position, key.length};
+  }
+
+  if (distance <= maxDistance) {
+    return {key.isAlias ? EmojiSearchScore::TYPO_2_ALIAS : EmojiSearchScore::TYPO_2_NAME, distance, position, key.length};
+  }
+
+  // "thumbsup" for "thumbs_up", the first character has to match so short searches don't match everything
+  if (text[0] != foldedSearch[0]) {
+    return {};
+  }
+
+  std::size_t searchIndex = 0;
+  for (unsigned int i = 0; i < key.length && searchIndex < foldedSearch.length(); i++) {
+    if (text[i] == foldedSearch[searchIndex]) {
+      searchIndex += 1;
+      position = i;
+    }
+  }
+
+  if (searchIndex == foldedSearch.length()) {
+    return {key.isAlias ? EmojiSearchScore::SUBSEQUENCE_ALIAS : EmojiSearchScore::SUBSEQUENCE_NAME, 0, position, key.length};
+  }
+
+  return {};
+}
+
+IncrementalEmojiSearch::IncrementalEmojiSearch(const EmojiSearchIndex& index) : _index(index) {
+}
+
+void IncrementalEmojiSearch::reset() {
+  _levels.clear();
+}
+
+const std::vector<int>& IncrementalEmojiSearch::search(std::string_view search, std::size_t limit, bool fuzzy, const std::function<bool(int)>& isDisabled) {
+  if (limit != _limit || fuzzy != _fuzzy) {
+    _limit = limit;
+    _fuzzy = fuzzy;
+    reset();
+  }
+
+  std::string foldedSearch = EmojiSearchIndex::foldCase(search);
+
+  while (!_levels.empty() && foldedSearch.compare(0, _levels.back().search.length(), _levels.back().search) != 0) {
+    _levels.pop_back();
+  }
+
+  if (!_levels.empty() && _levels.back().search == foldedSearch) {
+    return _levels.back().results;
+  }
+
+  EmojiSearchIndex::Range within = _levels.empty() ? _index.suffixes() : _levels.back().range;
+  EmojiSearchIndex::Range range = _index.findSuffixes(foldedSearch, within);
+
+  _levels.push_back({foldedSearch, range, _index.rank(foldedSearch, range, limit, fuzzy, isDisabled)});
+
+  return _levels.back().results;
+}
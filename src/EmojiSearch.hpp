@@ -0,0 +1,120 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class EmojiSearchMode {
+  AUTO,
+  CONTAINS,
+  STARTS_WITH,
+  EQUALS,
+};
+
+// lower is better, `search` ranks by score first and by emoji id last
+enum class EmojiSearchScore : unsigned char {
+  EXACT_NAME,
+  EXACT_ALIAS,
+  PREFIX_NAME,
+  PREFIX_ALIAS,
+  WORD_PREFIX_NAME,
+  WORD_PREFIX_ALIAS,
+  SUBSTRING_NAME,
+  SUBSTRING_ALIAS,
+  TYPO_1_NAME,
+  TYPO_1_ALIAS,
+  TYPO_2_NAME,
+  TYPO_2_ALIAS,
+  SUBSEQUENCE_NAME,
+  SUBSEQUENCE_ALIAS,
+  NONE,
+};
+
+// case-folded emoji names and aliases with a suffix array on top.
+// every prefix or substring lookup is a binary search over the suffixes instead of a scan over `emojis`.
+class EmojiSearchIndex {
+public:
+  // a range of suffixes which all start with the same search
+  struct Range {
+    unsigned int begin = 0;
+    unsigned int end = 0;
+  };
+
+  void build(const std::vector<std::vector<std::string>>& aliasesById);
+
+  bool empty() const;
+
+  Range suffixes() const;
+
+  // the suffixes starting with `foldedSearch` are always a subrange of the ones starting with any prefix of it
+  Range findSuffixes(std::string_view foldedSearch, Range within) const;
+
+  // returns the ids (index into `emojis`) of the `limit` best matches for `foldedSearch` in a single pass over `range`.
+  // substrings are only considered once `foldedSearch` has at least 3 characters.
+  // `fuzzy` additionally checks every key for typos (edit distance 1 or 2) and subsequences, those rank below everything else
+  std::vector<int> rank(std::string_view foldedSearch, Range range, std::size_t limit, bool fuzzy, const std::function<bool(int)>& isDisabled) const;
+
+  // unicode aware lowercase (utf-8 in and out), used for the keys and the search alike
+  static std::string foldCase(std::string_view text);
+
+private:
+  // typos and subsequences of the same score are ordered by how well they match, for every other score these stay 0
+  struct Match {
+    EmojiSearchScore score = EmojiSearchScore::NONE;
+    // edits needed for a typo
+    int distance = 0;
+    // where the match ends in the key, "heart" before "smiling_face_with_hearts" for "hert"
+    unsigned int position = 0;
+    // shorter keys leave less of the key unmatched
+    unsigned int length = 0;
+
+    bool operator<(const Match& other) const;
+  };
+
+  struct Key {
+    unsigned int offset;
+    unsigned int length;
+    int emojiId;
+    bool isAlias;
+  };
+
+  // all keys separated by '\0' so suffixes can be compared without knowing their length
+  std::string _keyData;
+  std::vector<Key> _keys;
+  // offsets into `_keyData`, sorted by the suffix starting there
+  std::vector<unsigned int> _suffixes;
+
+  void addKey(std::string_view text, int emojiId, bool isAlias);
+
+  const Key& keyAt(unsigned int offset) const;
+
+  EmojiSearchScore scoreMatch(const Key& key, unsigned int suffix, std::size_t searchLength) const;
+
+  Match scoreFuzzyMatch(const Key& key, std::string_view foldedSearch, const unsigned long long* searchMasks) const;
+};
+
+// keeps the suffix range and results of every prefix of the current search.
+// appending a character only narrows the previous range and removing one pops back to the cached results.
+class IncrementalEmojiSearch {
+public:
+  explicit IncrementalEmojiSearch(const EmojiSearchIndex& index);
+
+  // has to be called whenever the index or the disabled emojis change
+  void reset();
+
+  const std::vector<int>& search(std::string_view search, std::size_t limit, bool fuzzy, const std::function<bool(int)>& isDisabled);
+
+private:
+  struct Level {
+    std::string search;
+    EmojiSearchIndex::Range range;
+    std::vector<int> results;
+  };
+
+  const EmojiSearchIndex& _index;
+
+  std::vector<Level> _levels;
+  std::size_t _limit = 0;
+  bool _fuzzy = false;
+};
@@ -0,0 +1,140 @@
+#include "EmojiSearchWorker.hpp"
+
+EmojiSearchWorker::EmojiSearchWorker(QObject* parent) : QObject(parent) {
+  _thread = std::thread{&EmojiSearchWorker::run, this};
+}
+
+EmojiSearchWorker::~EmojiSearchWorker() {
+  std::unique_lock<decltype(_mutex)> lock{_mutex};
+  _stopped = true;
+  lock.unlock();
+  _condition.notify_one();
+
+  _resultsCondition.notify_all();
+
+  _thread.join();
+}
+
+void EmojiSearchWorker::setAliases(std::vector<std::vector<std::string>>&& aliasesById) {
+  std::unique_lock<decltype(_mutex)> lock{_mutex};
+  _aliasesChanged = true;
+  _aliasesById = std::move(aliasesById);
+  lock.unlock();
+  _condition.notify_one();
+}
+
+void EmojiSearchWorker::setDisabledEmojis(const std::vector<bool>& disabledEmojis) {
+  std::unique_lock<decltype(_mutex)> lock{_mutex};
+  _disabledEmojisChanged = true;
+  _disabledEmojis = disabledEmojis;
+  lock.unlock();
+  _condition.notify_one();
+}
+
+quint64 EmojiSearchWorker::search(const std::string& search, std::size_t limit, bool fuzzy) {
+  std::unique_lock<decltype(_mutex)> lock{_mutex};
+  _requestGeneration = ++_generation;
+  _requestSearch = search;
+  _requestLimit = limit;
+  _requestFuzzy = fuzzy;
+  lock.unlock();
+  _condition.notify_one();
+
+  return _requestGeneration;
+}
+
+void EmojiSearchWorker::cancel() {
+  ++_generation;
+}
+
+bool EmojiSearchWorker::takeResults(quint64 generation, std::vector<int>& results) {
+  std::lock_guard<decltype(_mutex)> lock{_mutex};
+
+  if (_resultsGeneration != generation || generation != _generation) {
+    return false;
+  }
+
+  results = std::move(_results);
+  _resultsGeneration = 0;
+  _takenGeneration = generation;
+
+  return true;
+}
+
+bool EmojiSearchWorker::waitForResults(quint64 generation, std::vector<int>& results) {
+  std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+  _resultsCondition.wait(lock, [this, generation]() {
+    return _stopped || _resultsGeneration == generation || _takenGeneration == generation || generation != _generation;
+  });
+
+  if (_resultsGeneration != generation || generation != _generation) {
+    return false;
+  }
+
+  results = std::move(_results);
+  _resultsGeneration = 0;
+  _takenGeneration = generation;
+
+  return true;
+}
+
+void EmojiSearchWorker::run() {
+  std::vector<bool> disabledEmojis;
+
+  auto isDisabled = [&disabledEmojis](int emojiId) {
+    return emojiId < (int)disabledEmojis.size() && disabledEmojis[emojiId];
+  };
+
+  while (true) {
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _condition.wait(lock, [this]() {
+      return _stopped || _aliasesChanged || _disabledEmojisChanged || _requestGeneration != 0;
+    });
+
+    if (_stopped) {
+      return;
+    }
+
+    bool aliasesChanged = _aliasesChanged;
+    auto aliasesById = std::move(_aliasesById);
+    _aliasesChanged = false;
+
+    if (_disabledEmojisChanged) {
+      disabledEmojis = std::move(_disabledEmojis);
+      _disabledEmojisChanged = false;
+      _search.reset();
+    }
+
+    quint64 generation = _requestGeneration;
+    std::string search = std::move(_requestSearch);
+    std::size_t limit = _requestLimit;
+    bool fuzzy = _requestFuzzy;
+    _requestGeneration = 0;
+
+    lock.unlock();
+
+    if (aliasesChanged) {
+      _index.build(aliasesById);
+      _search.reset();
+    }
+
+    // skip searches that were already replaced by a newer one before they even started
+    if (generation == 0 || generation != _generation) {
+      continue;
+    }
+
+    const std::vector<int>& results = _search.search(search, limit, fuzzy, isDisabled);
+
+    lock.lock();
+    if (generation != _generation) {
+      continue;
+    }
+    _resultsGeneration = generation;
+    _results = results;
+    lock.unlock();
+    _resultsCondition.notify_all();
+
+    emit resultsReady();
+  }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "EmojiSearch.hpp"
+#include <QObject>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// runs the emoji search on its own thread so typing never waits for it.
+// every search gets a generation number and only the results of the newest one are ever published.
+class EmojiSearchWorker : public QObject {
+  Q_OBJECT
+
+public:
+  explicit EmojiSearchWorker(QObject* parent = nullptr);
+
+  ~EmojiSearchWorker();
+
+  void setAliases(std::vector<std::vector<std::string>>&& aliasesById);
+
+  void setDisabledEmojis(const std::vector<bool>& disabledEmojis);
+
+  // returns the generation of this search which has to be passed to `takeResults`
+  quint64 search(const std::string& search, std::size_t limit, bool fuzzy);
+
+  // makes every pending search stale
+  void cancel();
+
+  bool takeResults(quint64 generation, std::vector<int>& results);
+
+  // blocks until the results of `generation` are published, false if it became stale (or its results were already taken)
+  bool waitForResults(quint64 generation, std::vector<int>& results);
+
+signals:
+  void resultsReady();
+
+private:
+  EmojiSearchIndex _index;
+  IncrementalEmojiSearch _search{_index};
+
+  std::atomic<quint64> _generation{0};
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::condition_variable _resultsCondition;
+  bool _stopped = false;
+
+  bool _aliasesChanged = false;
+  std::vector<std::vector<std::string>> _aliasesById;
+
+  bool _disabledEmojisChanged = false;
+  std::vector<bool> _disabledEmojis;
+
+  quint64 _requestGeneration = 0;
+  std::string _requestSearch;
+  std::size_t _requestLimit = 0;
+  bool _requestFuzzy = false;
+
+  quint64 _resultsGeneration = 0;
+  std::vector<int> _results;
+  quint64 _takenGeneration = 0;
+
+  std::thread _thread;
+
+  void run();
+};
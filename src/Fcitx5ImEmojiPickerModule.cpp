@@ -160,15 +160,13 @@ void Fcitx5ImEmojiPickerModule::keyEvent(fcitx::KeyEvent& keyEvent) {
     break;
   }
 
-  QKeyEvent* qevent = createKeyEventWithUserPreferences(_type, _key, _modifiers, _text);
-  EmojiAction action = getEmojiActionForQKeyEvent(qevent);
+  QKeyEvent qevent = createKeyEventWithUserPreferences(_type, _key, _modifiers, _text);
+  EmojiAction action = getEmojiActionForQKeyEvent(&qevent);
 
   if (action != EmojiAction::INVALID) {
-    emojiCommandQueue.push(std::make_shared<EmojiCommandProcessKeyEvent>(qevent, action));
+    emojiCommandQueue.push(EmojiCommandProcessKeyEvent{qevent, action});
 
     keyEvent.accept();
-  } else {
-    delete qevent;
   }
 
   if (_key == Qt::Key_Return && _type == QKeyEvent::KeyRelease) {
@@ -189,11 +187,11 @@ void Fcitx5ImEmojiPickerModule::activate(fcitx::InputContextEvent& event) {
 
   sendCursorLocation(event);
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandEnable>([this, inputContext{event.inputContext()}](const std::string& text) {
+  emojiCommandQueue.push(EmojiCommandEnable{[this, inputContext{event.inputContext()}](const std::string& text) {
     log_printf("[debug] Fcitx5ImEmojiPickerModule::(lambda) commitString:%s program:%s\n", text.data(), inputContext->program().data());
 
     inputContext->commitString(text);
-  }, false));
+  }, false});
 }
 
 void Fcitx5ImEmojiPickerModule::deactivate(fcitx::InputContextEvent& event) {
@@ -205,7 +203,7 @@ void Fcitx5ImEmojiPickerModule::deactivate(fcitx::InputContextEvent& event) {
 
   _active = false;
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandDisable>());
+  emojiCommandQueue.push(EmojiCommandDisable{});
 
   gui_set_active(false);
 }
@@ -213,7 +211,7 @@ void Fcitx5ImEmojiPickerModule::deactivate(fcitx::InputContextEvent& event) {
 void Fcitx5ImEmojiPickerModule::reset(fcitx::InputContextEvent& event) {
   log_printf("[debug] Fcitx5ImEmojiPickerModule::reset\n");
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandReset>());
+  emojiCommandQueue.push(EmojiCommandReset{});
 }
 
 void Fcitx5ImEmojiPickerModule::sendCursorLocation(fcitx::InputContextEvent& event) {
@@ -221,7 +219,7 @@ void Fcitx5ImEmojiPickerModule::sendCursorLocation(fcitx::InputContextEvent& eve
 
   log_printf("[debug] Fcitx5ImEmojiPickerModule::sendCursorLocation x:%d y:%d w:%d h:%d\n", r.left(), r.top(), r.width(), r.height());
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandSetCursorLocation>(new QRect(r.left(), r.top(), r.width(), r.height())));
+  emojiCommandQueue.push(EmojiCommandSetCursorLocation{QRect(r.left(), r.top(), r.width(), r.height())});
 }
 
 void Fcitx5ImEmojiPickerModule::reloadConfig() {
@@ -86,21 +86,21 @@ static void ibus_im_emoji_picker_engine_destroy(IBusImEmojiPickerEngine* emoji_e
 static void ibus_im_emoji_picker_engine_enable(IBusEngine* engine) {
   log_printf("[debug] ibus_im_emoji_picker_engine_enable\n");
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandEnable>([engine](const std::string& text) {
+  emojiCommandQueue.push(EmojiCommandEnable{[engine](const std::string& text) {
     ibus_engine_commit_text(engine, ibus_text_new_from_string(text.data()));
-  }));
+  }});
 }
 
 static void ibus_im_emoji_picker_engine_disable(IBusEngine* engine) {
   log_printf("[debug] ibus_im_emoji_picker_engine_disable\n");
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandDisable>());
+  emojiCommandQueue.push(EmojiCommandDisable{});
 }
 
 static void ibus_im_emoji_picker_engine_reset(IBusEngine* engine) {
   log_printf("[debug] ibus_im_emoji_picker_engine_reset\n");
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandReset>());
+  emojiCommandQueue.push(EmojiCommandReset{});
 }
 
 #define KEYCODE_ESCAPE 1
@@ -185,16 +185,14 @@ static gboolean ibus_im_emoji_picker_engine_process_key_event(IBusEngine* engine
     _modifiers |= Qt::ShiftModifier;
   }
 
-  QKeyEvent* qevent = createKeyEventWithUserPreferences(_type, _key, _modifiers, _text);
-  EmojiAction action = getEmojiActionForQKeyEvent(qevent);
+  QKeyEvent qevent = createKeyEventWithUserPreferences(_type, _key, _modifiers, _text);
+  EmojiAction action = getEmojiActionForQKeyEvent(&qevent);
 
   if (action != EmojiAction::INVALID) {
-    emojiCommandQueue.push(std::make_shared<EmojiCommandProcessKeyEvent>(qevent));
+    emojiCommandQueue.push(EmojiCommandProcessKeyEvent{qevent});
 
     return TRUE;
   } else {
-    delete qevent;
-
     return FALSE;
   }
 }
@@ -202,7 +200,7 @@ static gboolean ibus_im_emoji_picker_engine_process_key_event(IBusEngine* engine
 static void ibus_im_emoji_picker_engine_set_cursor_location(IBusEngine* engine, gint x, gint y, gint w, gint h) {
   log_printf("[debug] ibus_im_emoji_picker_engine_set_cursor_location x:%d y:%d w:%d h:%d\n", x, y, w, h);
 
-  emojiCommandQueue.push(std::make_shared<EmojiCommandSetCursorLocation>(new QRect(x, y, w, h)));
+  emojiCommandQueue.push(EmojiCommandSetCursorLocation{QRect(x, y, w, h)});
 }
 }
 
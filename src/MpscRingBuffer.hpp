@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// a bounded queue for any number of producer threads and one consumer thread.
+// neither side locks or allocates, the items are moved in and out of a fixed array.
+// every slot has a sequence number, a producer claims a slot by advancing the tail with a CAS
+// and publishes it by bumping the sequence, so the consumer never reads a half written slot
+template <typename T, std::size_t N>
+class MpscRingBuffer {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "the capacity has to be a power of 2");
+
+  struct Slot {
+    // `position` = free for the producer of that position, `position + 1` = written, ready to pop
+    std::atomic<std::size_t> sequence;
+    T item;
+  };
+
+  std::array<Slot, N> _slots;
+
+  // only grow and are masked on access.
+  // kept on separate cache lines so both sides don't invalidate each other on every push and pop
+  alignas(64) std::atomic<std::size_t> _head{0};
+  alignas(64) std::atomic<std::size_t> _tail{0};
+
+public:
+  MpscRingBuffer() {
+    for (std::size_t i = 0; i < N; i++) {
+      _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // returns false if the buffer is full
+  bool push(T&& item) {
+    std::size_t tail = _tail.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+      slot = &_slots[tail & (N - 1)];
+      std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+      if (sequence == tail) {
+        // on failure `tail` is reloaded and the next slot is tried
+        if (_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (sequence < tail) {
+        // not popped since the last round
+        return false;
+      } else {
+        // another producer claimed it first
+        tail = _tail.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->item = std::move(item);
+    slot->sequence.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  // only ever called by the consumer thread
+  bool pop(T& result) {
+    std::size_t head = _head.load(std::memory_order_relaxed);
+    Slot& slot = _slots[head & (N - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+      return false;
+    }
+
+    result = std::move(slot.item);
+    slot.sequence.store(head + N, std::memory_order_release);
+    _head.store(head + 1, std::memory_order_relaxed);
+
+    return true;
+  }
+};
@@ -1,3697 +0,0 @@
-#include "emojis.hpp"
-
-std::string Emoji::nameByLocale(const std::string& localeKey) const {
-  // NO CLDR
-
-  return name;
-}
-
-bool Emoji::isGenderVariation() const {
-  const char* MALE_SIGN   = "\U00002642";
-  const char* FEMALE_SIGN = "\U00002640";
-  const char* BOY         = "\U0001F466";
-  const char* GIRL        = "\U0001F467";
-  const char* MAN         = "\U0001F468";
-  const char* WOMAN       = "\U0001F469";
-
-  if (
-    code == MALE_SIGN   ||
-    code == FEMALE_SIGN ||
-    code == BOY         ||
-    code == GIRL        ||
-    code == MAN         ||
-    code == WOMAN
-  ) {
-    return false;
-  }
-
-  return (
-    code.find(MALE_SIGN) != std::string::npos   ||
-    code.find(FEMALE_SIGN) != std::string::npos ||
-    code.find(BOY) != std::string::npos         ||
-    code.find(GIRL) != std::string::npos        ||
-    code.find(MAN) != std::string::npos         ||
-    code.find(WOMAN) != std::string::npos
-  );
-}
-
-bool Emoji::isSkinToneVariation() const {
-  const char* LIGHT        = "\U0001F3FB";
-  const char* LIGHT_MEDIUM = "\U0001F3FC";
-  const char* MEDIUM       = "\U0001F3FD";
-  const char* DARK_MEDIUM  = "\U0001F3FE";
-  const char* DARK         = "\U0001F3FF";
-
-  if (
-    code == LIGHT        ||
-    code == LIGHT_MEDIUM ||
-    code == MEDIUM       ||
-    code == DARK_MEDIUM  ||
-    code == DARK
-  ) {
-    return false;
-  }
-
-  return (
-    code.find(LIGHT) != std::string::npos        ||
-    code.find(LIGHT_MEDIUM) != std::string::npos ||
-    code.find(MEDIUM) != std::string::npos       ||
-    code.find(DARK_MEDIUM) != std::string::npos  ||
-    code.find(DARK) != std::string::npos
-  );
-}
-
-bool Emoji::operator==(const Emoji& other) const {
-  return code == other.code;
-}
-
-Emoji::operator bool() const {
-  return code != "";
-}
-
-const Emoji emojis[] = {
-  {"grinning_face", "\U0001F600", 1},
-  {"grinning_face_with_big_eyes", "\U0001F603", 0},
-  {"grinning_face_with_smiling_eyes", "\U0001F604", 0},
-  {"beaming_face_with_smiling_eyes", "\U0001F601", 0},
-  {"grinning_squinting_face", "\U0001F606", 0},
-  {"grinning_face_with_sweat", "\U0001F605", 0},
-  {"rolling_on_the_floor_laughing", "\U0001F923", 3},
-  {"face_with_tears_of_joy", "\U0001F602", 0},
-  {"slightly_smiling_face", "\U0001F642", 1},
-  {"upside_down_face", "\U0001F643", 1},
-  {"melting_face", "\U0001FAE0", 14},
-  {"winking_face", "\U0001F609", 0},
-  {"smiling_face_with_smiling_eyes", "\U0001F60A", 0},
-  {"smiling_face_with_halo", "\U0001F607", 1},
-  {"smiling_face_with_hearts", "\U0001F970", 11},
-  {"smiling_face_with_heart_eyes", "\U0001F60D", 0},
-  {"star_struck", "\U0001F929", 5},
-  {"face_blowing_a_kiss", "\U0001F618", 0},
-  {"kissing_face", "\U0001F617", 1},
-  {"smiling_face", "\U0000263A", 0},
-  {"kissing_face_with_closed_eyes", "\U0001F61A", 0},
-  {"kissing_face_with_smiling_eyes", "\U0001F619", 1},
-  {"smiling_face_with_tear", "\U0001F972", 13},
-  {"face_savoring_food", "\U0001F60B", 0},
-  {"face_with_tongue", "\U0001F61B", 1},
-  {"winking_face_with_tongue", "\U0001F61C", 0},
-  {"zany_face", "\U0001F92A", 5},
-  {"squinting_face_with_tongue", "\U0001F61D", 0},
-  {"money_mouth_face", "\U0001F911", 1},
-  {"smiling_face_with_open_hands", "\U0001F917", 1},
-  {"face_with_hand_over_mouth", "\U0001F92D", 5},
-  {"face_with_open_eyes_and_hand_over_mouth", "\U0001FAE2", 14},
-  {"face_with_peeking_eye", "\U0001FAE3", 14},
-  {"shushing_face", "\U0001F92B", 5},
-  {"thinking_face", "\U0001F914", 1},
-  {"saluting_face", "\U0001FAE1", 14},
-  {"zipper_mouth_face", "\U0001F910", 1},
-  {"face_with_raised_eyebrow", "\U0001F928", 5},
-  {"neutral_face", "\U0001F610", 0},
-  {"expressionless_face", "\U0001F611", 1},
-  {"face_without_mouth", "\U0001F636", 1},
-  {"dotted_line_face", "\U0001FAE5", 14},
-  {"face_in_clouds", "\U0001F636\U0000200D\U0001F32B\U0000FE0F", 13},
-  {"smirking_face", "\U0001F60F", 0},
-  {"unamused_face", "\U0001F612", 0},
-  {"face_with_rolling_eyes", "\U0001F644", 1},
-  {"grimacing_face", "\U0001F62C", 1},
-  {"face_exhaling", "\U0001F62E\U0000200D\U0001F4A8", 13},
-  {"lying_face", "\U0001F925", 3},
-  {"relieved_face", "\U0001F60C", 0},
-  {"pensive_face", "\U0001F614", 0},
-  {"sleepy_face", "\U0001F62A", 0},
-  {"drooling_face", "\U0001F924", 3},
-  {"sleeping_face", "\U0001F634", 1},
-  {"face_with_medical_mask", "\U0001F637", 0},
-  {"face_with_thermometer", "\U0001F912", 1},
-  {"face_with_head_bandage", "\U0001F915", 1},
-  {"nauseated_face", "\U0001F922", 3},
-  {"face_vomiting", "\U0001F92E", 5},
-  {"sneezing_face", "\U0001F927", 3},
-  {"hot_face", "\U0001F975", 11},
-  {"cold_face", "\U0001F976", 11},
-  {"woozy_face", "\U0001F974", 11},
-  {"face_with_crossed_out_eyes", "\U0001F635", 0},
-  {"face_with_spiral_eyes", "\U0001F635\U0000200D\U0001F4AB", 13},
-  {"exploding_head", "\U0001F92F", 5},
-  {"cowboy_hat_face", "\U0001F920", 3},
-  {"partying_face", "\U0001F973", 11},
-  {"disguised_face", "\U0001F978", 13},
-  {"smiling_face_with_sunglasses", "\U0001F60E", 1},
-  {"nerd_face", "\U0001F913", 1},
-  {"face_with_monocle", "\U0001F9D0", 5},
-  {"confused_face", "\U0001F615", 1},
-  {"face_with_diagonal_mouth", "\U0001FAE4", 14},
-  {"worried_face", "\U0001F61F", 1},
-  {"slightly_frowning_face", "\U0001F641", 1},
-  {"frowning_face", "\U00002639", 0},
-  {"face_with_open_mouth", "\U0001F62E", 1},
-  {"hushed_face", "\U0001F62F", 1},
-  {"astonished_face", "\U0001F632", 0},
-  {"flushed_face", "\U0001F633", 0},
-  {"pleading_face", "\U0001F97A", 11},
-  {"face_holding_back_tears", "\U0001F979", 14},
-  {"frowning_face_with_open_mouth", "\U0001F626", 1},
-  {"anguished_face", "\U0001F627", 1},
-  {"fearful_face", "\U0001F628", 0},
-  {"anxious_face_with_sweat", "\U0001F630", 0},
-  {"sad_but_relieved_face", "\U0001F625", 0},
-  {"crying_face", "\U0001F622", 0},
-  {"loudly_crying_face", "\U0001F62D", 0},
-  {"face_screaming_in_fear", "\U0001F631", 0},
-  {"confounded_face", "\U0001F616", 0},
-  {"persevering_face", "\U0001F623", 0},
-  {"disappointed_face", "\U0001F61E", 0},
-  {"downcast_face_with_sweat", "\U0001F613", 0},
-  {"weary_face", "\U0001F629", 0},
-  {"tired_face", "\U0001F62B", 0},
-  {"yawning_face", "\U0001F971", 12},
-  {"face_with_steam_from_nose", "\U0001F624", 0},
-  {"pouting_face", "\U0001F621", 0},
-  {"angry_face", "\U0001F620", 0},
-  {"face_with_symbols_on_mouth", "\U0001F92C", 5},
-  {"smiling_face_with_horns", "\U0001F608", 1},
-  {"angry_face_with_horns", "\U0001F47F", 0},
-  {"skull", "\U0001F480", 0},
-  {"skull_and_crossbones", "\U00002620", 1},
-  {"pile_of_poo", "\U0001F4A9", 0},
-  {"clown_face", "\U0001F921", 3},
-  {"ogre", "\U0001F479", 0},
-  {"goblin", "\U0001F47A", 0},
-  {"ghost", "\U0001F47B", 0},
-  {"alien", "\U0001F47D", 0},
-  {"alien_monster", "\U0001F47E", 0},
-  {"robot", "\U0001F916", 1},
-  {"grinning_cat", "\U0001F63A", 0},
-  {"grinning_cat_with_smiling_eyes", "\U0001F638", 0},
-  {"cat_with_tears_of_joy", "\U0001F639", 0},
-  {"smiling_cat_with_heart_eyes", "\U0001F63B", 0},
-  {"cat_with_wry_smile", "\U0001F63C", 0},
-  {"kissing_cat", "\U0001F63D", 0},
-  {"weary_cat", "\U0001F640", 0},
-  {"crying_cat", "\U0001F63F", 0},
-  {"pouting_cat", "\U0001F63E", 0},
-  {"see_no_evil_monkey", "\U0001F648", 0},
-  {"hear_no_evil_monkey", "\U0001F649", 0},
-  {"speak_no_evil_monkey", "\U0001F64A", 0},
-  {"kiss_mark", "\U0001F48B", 0},
-  {"love_letter", "\U0001F48C", 0},
-  {"heart_with_arrow", "\U0001F498", 0},
-  {"heart_with_ribbon", "\U0001F49D", 0},
-  {"sparkling_heart", "\U0001F496", 0},
-  {"growing_heart", "\U0001F497", 0},
-  {"beating_heart", "\U0001F493", 0},
-  {"revolving_hearts", "\U0001F49E", 0},
-  {"two_hearts", "\U0001F495", 0},
-  {"heart_decoration", "\U0001F49F", 0},
-  {"heart_exclamation", "\U00002763", 1},
-  {"broken_heart", "\U0001F494", 0},
-  {"heart_on_fire", "\U00002764\U0000FE0F\U0000200D\U0001F525", 13},
-  {"mending_heart", "\U00002764\U0000FE0F\U0000200D\U0001FA79", 13},
-  {"red_heart", "\U00002764", 0},
-  {"orange_heart", "\U0001F9E1", 5},
-  {"yellow_heart", "\U0001F49B", 0},
-  {"green_heart", "\U0001F49A", 0},
-  {"blue_heart", "\U0001F499", 0},
-  {"purple_heart", "\U0001F49C", 0},
-  {"brown_heart", "\U0001F90E", 12},
-  {"black_heart", "\U0001F5A4", 3},
-  {"white_heart", "\U0001F90D", 12},
-  {"hundred_points", "\U0001F4AF", 0},
-  {"anger_symbol", "\U0001F4A2", 0},
-  {"collision", "\U0001F4A5", 0},
-  {"dizzy", "\U0001F4AB", 0},
-  {"sweat_droplets", "\U0001F4A6", 0},
-  {"dashing_away", "\U0001F4A8", 0},
-  {"hole", "\U0001F573", 0},
-  {"bomb", "\U0001F4A3", 0},
-  {"speech_balloon", "\U0001F4AC", 0},
-  {"eye_in_speech_bubble", "\U0001F441\U0000200D\U0001F5E8", 2},
-  {"left_speech_bubble", "\U0001F5E8", 2},
-  {"right_anger_bubble", "\U0001F5EF", 0},
-  {"thought_balloon", "\U0001F4AD", 1},
-  {"zzz", "\U0001F4A4", 0},
-  {"waving_hand", "\U0001F44B", 0},
-  {"waving_hand_light_skin_tone", "\U0001F44B\U0001F3FB", 1},
-  {"waving_hand_medium_light_skin_tone", "\U0001F44B\U0001F3FC", 1},
-  {"waving_hand_medium_skin_tone", "\U0001F44B\U0001F3FD", 1},
-  {"waving_hand_medium_dark_skin_tone", "\U0001F44B\U0001F3FE", 1},
-  {"waving_hand_dark_skin_tone", "\U0001F44B\U0001F3FF", 1},
-  {"raised_back_of_hand", "\U0001F91A", 3},
-  {"raised_back_of_hand_light_skin_tone", "\U0001F91A\U0001F3FB", 3},
-  {"raised_back_of_hand_medium_light_skin_tone", "\U0001F91A\U0001F3FC", 3},
-  {"raised_back_of_hand_medium_skin_tone", "\U0001F91A\U0001F3FD", 3},
-  {"raised_back_of_hand_medium_dark_skin_tone", "\U0001F91A\U0001F3FE", 3},
-  {"raised_back_of_hand_dark_skin_tone", "\U0001F91A\U0001F3FF", 3},
-  {"hand_with_fingers_splayed", "\U0001F590", 0},
-  {"hand_with_fingers_splayed_light_skin_tone", "\U0001F590\U0001F3FB", 1},
-  {"hand_with_fingers_splayed_medium_light_skin_tone", "\U0001F590\U0001F3FC", 1},
-  {"hand_with_fingers_splayed_medium_skin_tone", "\U0001F590\U0001F3FD", 1},
-  {"hand_with_fingers_splayed_medium_dark_skin_tone", "\U0001F590\U0001F3FE", 1},
-  {"hand_with_fingers_splayed_dark_skin_tone", "\U0001F590\U0001F3FF", 1},
-  {"raised_hand", "\U0000270B", 0},
-  {"raised_hand_light_skin_tone", "\U0000270B\U0001F3FB", 1},
-  {"raised_hand_medium_light_skin_tone", "\U0000270B\U0001F3FC", 1},
-  {"raised_hand_medium_skin_tone", "\U0000270B\U0001F3FD", 1},
-  {"raised_hand_medium_dark_skin_tone", "\U0000270B\U0001F3FE", 1},
-  {"raised_hand_dark_skin_tone", "\U0000270B\U0001F3FF", 1},
-  {"vulcan_salute", "\U0001F596", 1},
-  {"vulcan_salute_light_skin_tone", "\U0001F596\U0001F3FB", 1},
-  {"vulcan_salute_medium_light_skin_tone", "\U0001F596\U0001F3FC", 1},
-  {"vulcan_salute_medium_skin_tone", "\U0001F596\U0001F3FD", 1},
-  {"vulcan_salute_medium_dark_skin_tone", "\U0001F596\U0001F3FE", 1},
-  {"vulcan_salute_dark_skin_tone", "\U0001F596\U0001F3FF", 1},
-  {"rightwards_hand", "\U0001FAF1", 14},
-  {"rightwards_hand_light_skin_tone", "\U0001FAF1\U0001F3FB", 14},
-  {"rightwards_hand_medium_light_skin_tone", "\U0001FAF1\U0001F3FC", 14},
-  {"rightwards_hand_medium_skin_tone", "\U0001FAF1\U0001F3FD", 14},
-  {"rightwards_hand_medium_dark_skin_tone", "\U0001FAF1\U0001F3FE", 14},
-  {"rightwards_hand_dark_skin_tone", "\U0001FAF1\U0001F3FF", 14},
-  {"leftwards_hand", "\U0001FAF2", 14},
-  {"leftwards_hand_light_skin_tone", "\U0001FAF2\U0001F3FB", 14},
-  {"leftwards_hand_medium_light_skin_tone", "\U0001FAF2\U0001F3FC", 14},
-  {"leftwards_hand_medium_skin_tone", "\U0001FAF2\U0001F3FD", 14},
-  {"leftwards_hand_medium_dark_skin_tone", "\U0001FAF2\U0001F3FE", 14},
-  {"leftwards_hand_dark_skin_tone", "\U0001FAF2\U0001F3FF", 14},
-  {"palm_down_hand", "\U0001FAF3", 14},
-  {"palm_down_hand_light_skin_tone", "\U0001FAF3\U0001F3FB", 14},
-  {"palm_down_hand_medium_light_skin_tone", "\U0001FAF3\U0001F3FC", 14},
-  {"palm_down_hand_medium_skin_tone", "\U0001FAF3\U0001F3FD", 14},
-  {"palm_down_hand_medium_dark_skin_tone", "\U0001FAF3\U0001F3FE", 14},
-  {"palm_down_hand_dark_skin_tone", "\U0001FAF3\U0001F3FF", 14},
-  {"palm_up_hand", "\U0001FAF4", 14},
-  {"palm_up_hand_light_skin_tone", "\U0001FAF4\U0001F3FB", 14},
-  {"palm_up_hand_medium_light_skin_tone", "\U0001FAF4\U0001F3FC", 14},
-  {"palm_up_hand_medium_skin_tone", "\U0001FAF4\U0001F3FD", 14},
-  {"palm_up_hand_medium_dark_skin_tone", "\U0001FAF4\U0001F3FE", 14},
-  {"palm_up_hand_dark_skin_tone", "\U0001FAF4\U0001F3FF", 14},
-  {"ok_hand", "\U0001F44C", 0},
-  {"ok_hand_light_skin_tone", "\U0001F44C\U0001F3FB", 1},
-  {"ok_hand_medium_light_skin_tone", "\U0001F44C\U0001F3FC", 1},
-  {"ok_hand_medium_skin_tone", "\U0001F44C\U0001F3FD", 1},
-  {"ok_hand_medium_dark_skin_tone", "\U0001F44C\U0001F3FE", 1},
-  {"ok_hand_dark_skin_tone", "\U0001F44C\U0001F3FF", 1},
-  {"pinched_fingers", "\U0001F90C", 13},
-  {"pinched_fingers_light_skin_tone", "\U0001F90C\U0001F3FB", 13},
-  {"pinched_fingers_medium_light_skin_tone", "\U0001F90C\U0001F3FC", 13},
-  {"pinched_fingers_medium_skin_tone", "\U0001F90C\U0001F3FD", 13},
-  {"pinched_fingers_medium_dark_skin_tone", "\U0001F90C\U0001F3FE", 13},
-  {"pinched_fingers_dark_skin_tone", "\U0001F90C\U0001F3FF", 13},
-  {"pinching_hand", "\U0001F90F", 12},
-  {"pinching_hand_light_skin_tone", "\U0001F90F\U0001F3FB", 12},
-  {"pinching_hand_medium_light_skin_tone", "\U0001F90F\U0001F3FC", 12},
-  {"pinching_hand_medium_skin_tone", "\U0001F90F\U0001F3FD", 12},
-  {"pinching_hand_medium_dark_skin_tone", "\U0001F90F\U0001F3FE", 12},
-  {"pinching_hand_dark_skin_tone", "\U0001F90F\U0001F3FF", 12},
-  {"victory_hand", "\U0000270C", 0},
-  {"victory_hand_light_skin_tone", "\U0000270C\U0001F3FB", 1},
-  {"victory_hand_medium_light_skin_tone", "\U0000270C\U0001F3FC", 1},
-  {"victory_hand_medium_skin_tone", "\U0000270C\U0001F3FD", 1},
-  {"victory_hand_medium_dark_skin_tone", "\U0000270C\U0001F3FE", 1},
-  {"victory_hand_dark_skin_tone", "\U0000270C\U0001F3FF", 1},
-  {"crossed_fingers", "\U0001F91E", 3},
-  {"crossed_fingers_light_skin_tone", "\U0001F91E\U0001F3FB", 3},
-  {"crossed_fingers_medium_light_skin_tone", "\U0001F91E\U0001F3FC", 3},
-  {"crossed_fingers_medium_skin_tone", "\U0001F91E\U0001F3FD", 3},
-  {"crossed_fingers_medium_dark_skin_tone", "\U0001F91E\U0001F3FE", 3},
-  {"crossed_fingers_dark_skin_tone", "\U0001F91E\U0001F3FF", 3},
-  {"hand_with_index_finger_and_thumb_crossed", "\U0001FAF0", 14},
-  {"hand_with_index_finger_and_thumb_crossed_light_skin_tone", "\U0001FAF0\U0001F3FB", 14},
-  {"hand_with_index_finger_and_thumb_crossed_medium_light_skin_tone", "\U0001FAF0\U0001F3FC", 14},
-  {"hand_with_index_finger_and_thumb_crossed_medium_skin_tone", "\U0001FAF0\U0001F3FD", 14},
-  {"hand_with_index_finger_and_thumb_crossed_medium_dark_skin_tone", "\U0001FAF0\U0001F3FE", 14},
-  {"hand_with_index_finger_and_thumb_crossed_dark_skin_tone", "\U0001FAF0\U0001F3FF", 14},
-  {"love_you_gesture", "\U0001F91F", 5},
-  {"love_you_gesture_light_skin_tone", "\U0001F91F\U0001F3FB", 5},
-  {"love_you_gesture_medium_light_skin_tone", "\U0001F91F\U0001F3FC", 5},
-  {"love_you_gesture_medium_skin_tone", "\U0001F91F\U0001F3FD", 5},
-  {"love_you_gesture_medium_dark_skin_tone", "\U0001F91F\U0001F3FE", 5},
-  {"love_you_gesture_dark_skin_tone", "\U0001F91F\U0001F3FF", 5},
-  {"sign_of_the_horns", "\U0001F918", 1},
-  {"sign_of_the_horns_light_skin_tone", "\U0001F918\U0001F3FB", 1},
-  {"sign_of_the_horns_medium_light_skin_tone", "\U0001F918\U0001F3FC", 1},
-  {"sign_of_the_horns_medium_skin_tone", "\U0001F918\U0001F3FD", 1},
-  {"sign_of_the_horns_medium_dark_skin_tone", "\U0001F918\U0001F3FE", 1},
-  {"sign_of_the_horns_dark_skin_tone", "\U0001F918\U0001F3FF", 1},
-  {"call_me_hand", "\U0001F919", 3},
-  {"call_me_hand_light_skin_tone", "\U0001F919\U0001F3FB", 3},
-  {"call_me_hand_medium_light_skin_tone", "\U0001F919\U0001F3FC", 3},
-  {"call_me_hand_medium_skin_tone", "\U0001F919\U0001F3FD", 3},
-  {"call_me_hand_medium_dark_skin_tone", "\U0001F919\U0001F3FE", 3},
-  {"call_me_hand_dark_skin_tone", "\U0001F919\U0001F3FF", 3},
-  {"backhand_index_pointing_left", "\U0001F448", 0},
-  {"backhand_index_pointing_left_light_skin_tone", "\U0001F448\U0001F3FB", 1},
-  {"backhand_index_pointing_left_medium_light_skin_tone", "\U0001F448\U0001F3FC", 1},
-  {"backhand_index_pointing_left_medium_skin_tone", "\U0001F448\U0001F3FD", 1},
-  {"backhand_index_pointing_left_medium_dark_skin_tone", "\U0001F448\U0001F3FE", 1},
-  {"backhand_index_pointing_left_dark_skin_tone", "\U0001F448\U0001F3FF", 1},
-  {"backhand_index_pointing_right", "\U0001F449", 0},
-  {"backhand_index_pointing_right_light_skin_tone", "\U0001F449\U0001F3FB", 1},
-  {"backhand_index_pointing_right_medium_light_skin_tone", "\U0001F449\U0001F3FC", 1},
-  {"backhand_index_pointing_right_medium_skin_tone", "\U0001F449\U0001F3FD", 1},
-  {"backhand_index_pointing_right_medium_dark_skin_tone", "\U0001F449\U0001F3FE", 1},
-  {"backhand_index_pointing_right_dark_skin_tone", "\U0001F449\U0001F3FF", 1},
-  {"backhand_index_pointing_up", "\U0001F446", 0},
-  {"backhand_index_pointing_up_light_skin_tone", "\U0001F446\U0001F3FB", 1},
-  {"backhand_index_pointing_up_medium_light_skin_tone", "\U0001F446\U0001F3FC", 1},
-  {"backhand_index_pointing_up_medium_skin_tone", "\U0001F446\U0001F3FD", 1},
-  {"backhand_index_pointing_up_medium_dark_skin_tone", "\U0001F446\U0001F3FE", 1},
-  {"backhand_index_pointing_up_dark_skin_tone", "\U0001F446\U0001F3FF", 1},
-  {"middle_finger", "\U0001F595", 1},
-  {"middle_finger_light_skin_tone", "\U0001F595\U0001F3FB", 1},
-  {"middle_finger_medium_light_skin_tone", "\U0001F595\U0001F3FC", 1},
-  {"middle_finger_medium_skin_tone", "\U0001F595\U0001F3FD", 1},
-  {"middle_finger_medium_dark_skin_tone", "\U0001F595\U0001F3FE", 1},
-  {"middle_finger_dark_skin_tone", "\U0001F595\U0001F3FF", 1},
-  {"backhand_index_pointing_down", "\U0001F447", 0},
-  {"backhand_index_pointing_down_light_skin_tone", "\U0001F447\U0001F3FB", 1},
-  {"backhand_index_pointing_down_medium_light_skin_tone", "\U0001F447\U0001F3FC", 1},
-  {"backhand_index_pointing_down_medium_skin_tone", "\U0001F447\U0001F3FD", 1},
-  {"backhand_index_pointing_down_medium_dark_skin_tone", "\U0001F447\U0001F3FE", 1},
-  {"backhand_index_pointing_down_dark_skin_tone", "\U0001F447\U0001F3FF", 1},
-  {"index_pointing_up", "\U0000261D", 0},
-  {"index_pointing_up_light_skin_tone", "\U0000261D\U0001F3FB", 1},
-  {"index_pointing_up_medium_light_skin_tone", "\U0000261D\U0001F3FC", 1},
-  {"index_pointing_up_medium_skin_tone", "\U0000261D\U0001F3FD", 1},
-  {"index_pointing_up_medium_dark_skin_tone", "\U0000261D\U0001F3FE", 1},
-  {"index_pointing_up_dark_skin_tone", "\U0000261D\U0001F3FF", 1},
-  {"index_pointing_at_the_viewer", "\U0001FAF5", 14},
-  {"index_pointing_at_the_viewer_light_skin_tone", "\U0001FAF5\U0001F3FB", 14},
-  {"index_pointing_at_the_viewer_medium_light_skin_tone", "\U0001FAF5\U0001F3FC", 14},
-  {"index_pointing_at_the_viewer_medium_skin_tone", "\U0001FAF5\U0001F3FD", 14},
-  {"index_pointing_at_the_viewer_medium_dark_skin_tone", "\U0001FAF5\U0001F3FE", 14},
-  {"index_pointing_at_the_viewer_dark_skin_tone", "\U0001FAF5\U0001F3FF", 14},
-  {"thumbs_up", "\U0001F44D", 0},
-  {"thumbs_up_light_skin_tone", "\U0001F44D\U0001F3FB", 1},
-  {"thumbs_up_medium_light_skin_tone", "\U0001F44D\U0001F3FC", 1},
-  {"thumbs_up_medium_skin_tone", "\U0001F44D\U0001F3FD", 1},
-  {"thumbs_up_medium_dark_skin_tone", "\U0001F44D\U0001F3FE", 1},
-  {"thumbs_up_dark_skin_tone", "\U0001F44D\U0001F3FF", 1},
-  {"thumbs_down", "\U0001F44E", 0},
-  {"thumbs_down_light_skin_tone", "\U0001F44E\U0001F3FB", 1},
-  {"thumbs_down_medium_light_skin_tone", "\U0001F44E\U0001F3FC", 1},
-  {"thumbs_down_medium_skin_tone", "\U0001F44E\U0001F3FD", 1},
-  {"thumbs_down_medium_dark_skin_tone", "\U0001F44E\U0001F3FE", 1},
-  {"thumbs_down_dark_skin_tone", "\U0001F44E\U0001F3FF", 1},
-  {"raised_fist", "\U0000270A", 0},
-  {"raised_fist_light_skin_tone", "\U0000270A\U0001F3FB", 1},
-  {"raised_fist_medium_light_skin_tone", "\U0000270A\U0001F3FC", 1},
-  {"raised_fist_medium_skin_tone", "\U0000270A\U0001F3FD", 1},
-  {"raised_fist_medium_dark_skin_tone", "\U0000270A\U0001F3FE", 1},
-  {"raised_fist_dark_skin_tone", "\U0000270A\U0001F3FF", 1},
-  {"oncoming_fist", "\U0001F44A", 0},
-  {"oncoming_fist_light_skin_tone", "\U0001F44A\U0001F3FB", 1},
-  {"oncoming_fist_medium_light_skin_tone", "\U0001F44A\U0001F3FC", 1},
-  {"oncoming_fist_medium_skin_tone", "\U0001F44A\U0001F3FD", 1},
-  {"oncoming_fist_medium_dark_skin_tone", "\U0001F44A\U0001F3FE", 1},
-  {"oncoming_fist_dark_skin_tone", "\U0001F44A\U0001F3FF", 1},
-  {"left_facing_fist", "\U0001F91B", 3},
-  {"left_facing_fist_light_skin_tone", "\U0001F91B\U0001F3FB", 3},
-  {"left_facing_fist_medium_light_skin_tone", "\U0001F91B\U0001F3FC", 3},
-  {"left_facing_fist_medium_skin_tone", "\U0001F91B\U0001F3FD", 3},
-  {"left_facing_fist_medium_dark_skin_tone", "\U0001F91B\U0001F3FE", 3},
-  {"left_facing_fist_dark_skin_tone", "\U0001F91B\U0001F3FF", 3},
-  {"right_facing_fist", "\U0001F91C", 3},
-  {"right_facing_fist_light_skin_tone", "\U0001F91C\U0001F3FB", 3},
-  {"right_facing_fist_medium_light_skin_tone", "\U0001F91C\U0001F3FC", 3},
-  {"right_facing_fist_medium_skin_tone", "\U0001F91C\U0001F3FD", 3},
-  {"right_facing_fist_medium_dark_skin_tone", "\U0001F91C\U0001F3FE", 3},
-  {"right_facing_fist_dark_skin_tone", "\U0001F91C\U0001F3FF", 3},
-  {"clapping_hands", "\U0001F44F", 0},
-  {"clapping_hands_light_skin_tone", "\U0001F44F\U0001F3FB", 1},
-  {"clapping_hands_medium_light_skin_tone", "\U0001F44F\U0001F3FC", 1},
-  {"clapping_hands_medium_skin_tone", "\U0001F44F\U0001F3FD", 1},
-  {"clapping_hands_medium_dark_skin_tone", "\U0001F44F\U0001F3FE", 1},
-  {"clapping_hands_dark_skin_tone", "\U0001F44F\U0001F3FF", 1},
-  {"raising_hands", "\U0001F64C", 0},
-  {"raising_hands_light_skin_tone", "\U0001F64C\U0001F3FB", 1},
-  {"raising_hands_medium_light_skin_tone", "\U0001F64C\U0001F3FC", 1},
-  {"raising_hands_medium_skin_tone", "\U0001F64C\U0001F3FD", 1},
-  {"raising_hands_medium_dark_skin_tone", "\U0001F64C\U0001F3FE", 1},
-  {"raising_hands_dark_skin_tone", "\U0001F64C\U0001F3FF", 1},
-  {"heart_hands", "\U0001FAF6", 14},
-  {"heart_hands_light_skin_tone", "\U0001FAF6\U0001F3FB", 14},
-  {"heart_hands_medium_light_skin_tone", "\U0001FAF6\U0001F3FC", 14},
-  {"heart_hands_medium_skin_tone", "\U0001FAF6\U0001F3FD", 14},
-  {"heart_hands_medium_dark_skin_tone", "\U0001FAF6\U0001F3FE", 14},
-  {"heart_hands_dark_skin_tone", "\U0001FAF6\U0001F3FF", 14},
-  {"open_hands", "\U0001F450", 0},
-  {"open_hands_light_skin_tone", "\U0001F450\U0001F3FB", 1},
-  {"open_hands_medium_light_skin_tone", "\U0001F450\U0001F3FC", 1},
-  {"open_hands_medium_skin_tone", "\U0001F450\U0001F3FD", 1},
-  {"open_hands_medium_dark_skin_tone", "\U0001F450\U0001F3FE", 1},
-  {"open_hands_dark_skin_tone", "\U0001F450\U0001F3FF", 1},
-  {"palms_up_together", "\U0001F932", 5},
-  {"palms_up_together_light_skin_tone", "\U0001F932\U0001F3FB", 5},
-  {"palms_up_together_medium_light_skin_tone", "\U0001F932\U0001F3FC", 5},
-  {"palms_up_together_medium_skin_tone", "\U0001F932\U0001F3FD", 5},
-  {"palms_up_together_medium_dark_skin_tone", "\U0001F932\U0001F3FE", 5},
-  {"palms_up_together_dark_skin_tone", "\U0001F932\U0001F3FF", 5},
-  {"handshake", "\U0001F91D", 3},
-  {"handshake_light_skin_tone", "\U0001F91D\U0001F3FB", 3},
-  {"handshake_medium_light_skin_tone", "\U0001F91D\U0001F3FC", 3},
-  {"handshake_medium_skin_tone", "\U0001F91D\U0001F3FD", 3},
-  {"handshake_medium_dark_skin_tone", "\U0001F91D\U0001F3FE", 3},
-  {"handshake_dark_skin_tone", "\U0001F91D\U0001F3FF", 3},
-  {"handshake_light_skin_tone_medium_light_skin_tone", "\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FC", 14},
-  {"handshake_light_skin_tone_medium_skin_tone", "\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FD", 14},
-  {"handshake_light_skin_tone_medium_dark_skin_tone", "\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FE", 14},
-  {"handshake_light_skin_tone_dark_skin_tone", "\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FF", 14},
-  {"handshake_medium_light_skin_tone_light_skin_tone", "\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FB", 14},
-  {"handshake_medium_light_skin_tone_medium_skin_tone", "\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FD", 14},
-  {"handshake_medium_light_skin_tone_medium_dark_skin_tone", "\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FE", 14},
-  {"handshake_medium_light_skin_tone_dark_skin_tone", "\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FF", 14},
-  {"handshake_medium_skin_tone_light_skin_tone", "\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FB", 14},
-  {"handshake_medium_skin_tone_medium_light_skin_tone", "\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FC", 14},
-  {"handshake_medium_skin_tone_medium_dark_skin_tone", "\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FE", 14},
-  {"handshake_medium_skin_tone_dark_skin_tone", "\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FF", 14},
-  {"handshake_medium_dark_skin_tone_light_skin_tone", "\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FB", 14},
-  {"handshake_medium_dark_skin_tone_medium_light_skin_tone", "\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FC", 14},
-  {"handshake_medium_dark_skin_tone_medium_skin_tone", "\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FD", 14},
-  {"handshake_medium_dark_skin_tone_dark_skin_tone", "\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FF", 14},
-  {"handshake_dark_skin_tone_light_skin_tone", "\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FB", 14},
-  {"handshake_dark_skin_tone_medium_light_skin_tone", "\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FC", 14},
-  {"handshake_dark_skin_tone_medium_skin_tone", "\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FD", 14},
-  {"handshake_dark_skin_tone_medium_dark_skin_tone", "\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FE", 14},
-  {"folded_hands", "\U0001F64F", 0},
-  {"folded_hands_light_skin_tone", "\U0001F64F\U0001F3FB", 1},
-  {"folded_hands_medium_light_skin_tone", "\U0001F64F\U0001F3FC", 1},
-  {"folded_hands_medium_skin_tone", "\U0001F64F\U0001F3FD", 1},
-  {"folded_hands_medium_dark_skin_tone", "\U0001F64F\U0001F3FE", 1},
-  {"folded_hands_dark_skin_tone", "\U0001F64F\U0001F3FF", 1},
-  {"writing_hand", "\U0000270D", 0},
-  {"writing_hand_light_skin_tone", "\U0000270D\U0001F3FB", 1},
-  {"writing_hand_medium_light_skin_tone", "\U0000270D\U0001F3FC", 1},
-  {"writing_hand_medium_skin_tone", "\U0000270D\U0001F3FD", 1},
-  {"writing_hand_medium_dark_skin_tone", "\U0000270D\U0001F3FE", 1},
-  {"writing_hand_dark_skin_tone", "\U0000270D\U0001F3FF", 1},
-  {"nail_polish", "\U0001F485", 0},
-  {"nail_polish_light_skin_tone", "\U0001F485\U0001F3FB", 1},
-  {"nail_polish_medium_light_skin_tone", "\U0001F485\U0001F3FC", 1},
-  {"nail_polish_medium_skin_tone", "\U0001F485\U0001F3FD", 1},
-  {"nail_polish_medium_dark_skin_tone", "\U0001F485\U0001F3FE", 1},
-  {"nail_polish_dark_skin_tone", "\U0001F485\U0001F3FF", 1},
-  {"selfie", "\U0001F933", 3},
-  {"selfie_light_skin_tone", "\U0001F933\U0001F3FB", 3},
-  {"selfie_medium_light_skin_tone", "\U0001F933\U0001F3FC", 3},
-  {"selfie_medium_skin_tone", "\U0001F933\U0001F3FD", 3},
-  {"selfie_medium_dark_skin_tone", "\U0001F933\U0001F3FE", 3},
-  {"selfie_dark_skin_tone", "\U0001F933\U0001F3FF", 3},
-  {"flexed_biceps", "\U0001F4AA", 0},
-  {"flexed_biceps_light_skin_tone", "\U0001F4AA\U0001F3FB", 1},
-  {"flexed_biceps_medium_light_skin_tone", "\U0001F4AA\U0001F3FC", 1},
-  {"flexed_biceps_medium_skin_tone", "\U0001F4AA\U0001F3FD", 1},
-  {"flexed_biceps_medium_dark_skin_tone", "\U0001F4AA\U0001F3FE", 1},
-  {"flexed_biceps_dark_skin_tone", "\U0001F4AA\U0001F3FF", 1},
-  {"mechanical_arm", "\U0001F9BE", 12},
-  {"mechanical_leg", "\U0001F9BF", 12},
-  {"leg", "\U0001F9B5", 11},
-  {"leg_light_skin_tone", "\U0001F9B5\U0001F3FB", 11},
-  {"leg_medium_light_skin_tone", "\U0001F9B5\U0001F3FC", 11},
-  {"leg_medium_skin_tone", "\U0001F9B5\U0001F3FD", 11},
-  {"leg_medium_dark_skin_tone", "\U0001F9B5\U0001F3FE", 11},
-  {"leg_dark_skin_tone", "\U0001F9B5\U0001F3FF", 11},
-  {"foot", "\U0001F9B6", 11},
-  {"foot_light_skin_tone", "\U0001F9B6\U0001F3FB", 11},
-  {"foot_medium_light_skin_tone", "\U0001F9B6\U0001F3FC", 11},
-  {"foot_medium_skin_tone", "\U0001F9B6\U0001F3FD", 11},
-  {"foot_medium_dark_skin_tone", "\U0001F9B6\U0001F3FE", 11},
-  {"foot_dark_skin_tone", "\U0001F9B6\U0001F3FF", 11},
-  {"ear", "\U0001F442", 0},
-  {"ear_light_skin_tone", "\U0001F442\U0001F3FB", 1},
-  {"ear_medium_light_skin_tone", "\U0001F442\U0001F3FC", 1},
-  {"ear_medium_skin_tone", "\U0001F442\U0001F3FD", 1},
-  {"ear_medium_dark_skin_tone", "\U0001F442\U0001F3FE", 1},
-  {"ear_dark_skin_tone", "\U0001F442\U0001F3FF", 1},
-  {"ear_with_hearing_aid", "\U0001F9BB", 12},
-  {"ear_with_hearing_aid_light_skin_tone", "\U0001F9BB\U0001F3FB", 12},
-  {"ear_with_hearing_aid_medium_light_skin_tone", "\U0001F9BB\U0001F3FC", 12},
-  {"ear_with_hearing_aid_medium_skin_tone", "\U0001F9BB\U0001F3FD", 12},
-  {"ear_with_hearing_aid_medium_dark_skin_tone", "\U0001F9BB\U0001F3FE", 12},
-  {"ear_with_hearing_aid_dark_skin_tone", "\U0001F9BB\U0001F3FF", 12},
-  {"nose", "\U0001F443", 0},
-  {"nose_light_skin_tone", "\U0001F443\U0001F3FB", 1},
-  {"nose_medium_light_skin_tone", "\U0001F443\U0001F3FC", 1},
-  {"nose_medium_skin_tone", "\U0001F443\U0001F3FD", 1},
-  {"nose_medium_dark_skin_tone", "\U0001F443\U0001F3FE", 1},
-  {"nose_dark_skin_tone", "\U0001F443\U0001F3FF", 1},
-  {"brain", "\U0001F9E0", 5},
-  {"anatomical_heart", "\U0001FAC0", 13},
-  {"lungs", "\U0001FAC1", 13},
-  {"tooth", "\U0001F9B7", 11},
-  {"bone", "\U0001F9B4", 11},
-  {"eyes", "\U0001F440", 0},
-  {"eye", "\U0001F441", 0},
-  {"tongue", "\U0001F445", 0},
-  {"mouth", "\U0001F444", 0},
-  {"biting_lip", "\U0001FAE6", 14},
-  {"baby", "\U0001F476", 0},
-  {"baby_light_skin_tone", "\U0001F476\U0001F3FB", 1},
-  {"baby_medium_light_skin_tone", "\U0001F476\U0001F3FC", 1},
-  {"baby_medium_skin_tone", "\U0001F476\U0001F3FD", 1},
-  {"baby_medium_dark_skin_tone", "\U0001F476\U0001F3FE", 1},
-  {"baby_dark_skin_tone", "\U0001F476\U0001F3FF", 1},
-  {"child", "\U0001F9D2", 5},
-  {"child_light_skin_tone", "\U0001F9D2\U0001F3FB", 5},
-  {"child_medium_light_skin_tone", "\U0001F9D2\U0001F3FC", 5},
-  {"child_medium_skin_tone", "\U0001F9D2\U0001F3FD", 5},
-  {"child_medium_dark_skin_tone", "\U0001F9D2\U0001F3FE", 5},
-  {"child_dark_skin_tone", "\U0001F9D2\U0001F3FF", 5},
-  {"boy", "\U0001F466", 0},
-  {"boy_light_skin_tone", "\U0001F466\U0001F3FB", 1},
-  {"boy_medium_light_skin_tone", "\U0001F466\U0001F3FC", 1},
-  {"boy_medium_skin_tone", "\U0001F466\U0001F3FD", 1},
-  {"boy_medium_dark_skin_tone", "\U0001F466\U0001F3FE", 1},
-  {"boy_dark_skin_tone", "\U0001F466\U0001F3FF", 1},
-  {"girl", "\U0001F467", 0},
-  {"girl_light_skin_tone", "\U0001F467\U0001F3FB", 1},
-  {"girl_medium_light_skin_tone", "\U0001F467\U0001F3FC", 1},
-  {"girl_medium_skin_tone", "\U0001F467\U0001F3FD", 1},
-  {"girl_medium_dark_skin_tone", "\U0001F467\U0001F3FE", 1},
-  {"girl_dark_skin_tone", "\U0001F467\U0001F3FF", 1},
-  {"person", "\U0001F9D1", 5},
-  {"person_light_skin_tone", "\U0001F9D1\U0001F3FB", 5},
-  {"person_medium_light_skin_tone", "\U0001F9D1\U0001F3FC", 5},
-  {"person_medium_skin_tone", "\U0001F9D1\U0001F3FD", 5},
-  {"person_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE", 5},
-  {"person_dark_skin_tone", "\U0001F9D1\U0001F3FF", 5},
-  {"person_blond_hair", "\U0001F471", 0},
-  {"person_light_skin_tone_blond_hair", "\U0001F471\U0001F3FB", 1},
-  {"person_medium_light_skin_tone_blond_hair", "\U0001F471\U0001F3FC", 1},
-  {"person_medium_skin_tone_blond_hair", "\U0001F471\U0001F3FD", 1},
-  {"person_medium_dark_skin_tone_blond_hair", "\U0001F471\U0001F3FE", 1},
-  {"person_dark_skin_tone_blond_hair", "\U0001F471\U0001F3FF", 1},
-  {"man", "\U0001F468", 0},
-  {"man_light_skin_tone", "\U0001F468\U0001F3FB", 1},
-  {"man_medium_light_skin_tone", "\U0001F468\U0001F3FC", 1},
-  {"man_medium_skin_tone", "\U0001F468\U0001F3FD", 1},
-  {"man_medium_dark_skin_tone", "\U0001F468\U0001F3FE", 1},
-  {"man_dark_skin_tone", "\U0001F468\U0001F3FF", 1},
-  {"person_beard", "\U0001F9D4", 5},
-  {"person_light_skin_tone_beard", "\U0001F9D4\U0001F3FB", 5},
-  {"person_medium_light_skin_tone_beard", "\U0001F9D4\U0001F3FC", 5},
-  {"person_medium_skin_tone_beard", "\U0001F9D4\U0001F3FD", 5},
-  {"person_medium_dark_skin_tone_beard", "\U0001F9D4\U0001F3FE", 5},
-  {"person_dark_skin_tone_beard", "\U0001F9D4\U0001F3FF", 5},
-  {"man_beard", "\U0001F9D4\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_light_skin_tone_beard", "\U0001F9D4\U0001F3FB\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_medium_light_skin_tone_beard", "\U0001F9D4\U0001F3FC\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_medium_skin_tone_beard", "\U0001F9D4\U0001F3FD\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_medium_dark_skin_tone_beard", "\U0001F9D4\U0001F3FE\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_dark_skin_tone_beard", "\U0001F9D4\U0001F3FF\U0000200D\U00002642\U0000FE0F", 13},
-  {"woman_beard", "\U0001F9D4\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_light_skin_tone_beard", "\U0001F9D4\U0001F3FB\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_medium_light_skin_tone_beard", "\U0001F9D4\U0001F3FC\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_medium_skin_tone_beard", "\U0001F9D4\U0001F3FD\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_medium_dark_skin_tone_beard", "\U0001F9D4\U0001F3FE\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_dark_skin_tone_beard", "\U0001F9D4\U0001F3FF\U0000200D\U00002640\U0000FE0F", 13},
-  {"man_red_hair", "\U0001F468\U0000200D\U0001F9B0", 11},
-  {"man_light_skin_tone_red_hair", "\U0001F468\U0001F3FB\U0000200D\U0001F9B0", 11},
-  {"man_medium_light_skin_tone_red_hair", "\U0001F468\U0001F3FC\U0000200D\U0001F9B0", 11},
-  {"man_medium_skin_tone_red_hair", "\U0001F468\U0001F3FD\U0000200D\U0001F9B0", 11},
-  {"man_medium_dark_skin_tone_red_hair", "\U0001F468\U0001F3FE\U0000200D\U0001F9B0", 11},
-  {"man_dark_skin_tone_red_hair", "\U0001F468\U0001F3FF\U0000200D\U0001F9B0", 11},
-  {"man_curly_hair", "\U0001F468\U0000200D\U0001F9B1", 11},
-  {"man_light_skin_tone_curly_hair", "\U0001F468\U0001F3FB\U0000200D\U0001F9B1", 11},
-  {"man_medium_light_skin_tone_curly_hair", "\U0001F468\U0001F3FC\U0000200D\U0001F9B1", 11},
-  {"man_medium_skin_tone_curly_hair", "\U0001F468\U0001F3FD\U0000200D\U0001F9B1", 11},
-  {"man_medium_dark_skin_tone_curly_hair", "\U0001F468\U0001F3FE\U0000200D\U0001F9B1", 11},
-  {"man_dark_skin_tone_curly_hair", "\U0001F468\U0001F3FF\U0000200D\U0001F9B1", 11},
-  {"man_white_hair", "\U0001F468\U0000200D\U0001F9B3", 11},
-  {"man_light_skin_tone_white_hair", "\U0001F468\U0001F3FB\U0000200D\U0001F9B3", 11},
-  {"man_medium_light_skin_tone_white_hair", "\U0001F468\U0001F3FC\U0000200D\U0001F9B3", 11},
-  {"man_medium_skin_tone_white_hair", "\U0001F468\U0001F3FD\U0000200D\U0001F9B3", 11},
-  {"man_medium_dark_skin_tone_white_hair", "\U0001F468\U0001F3FE\U0000200D\U0001F9B3", 11},
-  {"man_dark_skin_tone_white_hair", "\U0001F468\U0001F3FF\U0000200D\U0001F9B3", 11},
-  {"man_bald", "\U0001F468\U0000200D\U0001F9B2", 11},
-  {"man_light_skin_tone_bald", "\U0001F468\U0001F3FB\U0000200D\U0001F9B2", 11},
-  {"man_medium_light_skin_tone_bald", "\U0001F468\U0001F3FC\U0000200D\U0001F9B2", 11},
-  {"man_medium_skin_tone_bald", "\U0001F468\U0001F3FD\U0000200D\U0001F9B2", 11},
-  {"man_medium_dark_skin_tone_bald", "\U0001F468\U0001F3FE\U0000200D\U0001F9B2", 11},
-  {"man_dark_skin_tone_bald", "\U0001F468\U0001F3FF\U0000200D\U0001F9B2", 11},
-  {"woman", "\U0001F469", 0},
-  {"woman_light_skin_tone", "\U0001F469\U0001F3FB", 1},
-  {"woman_medium_light_skin_tone", "\U0001F469\U0001F3FC", 1},
-  {"woman_medium_skin_tone", "\U0001F469\U0001F3FD", 1},
-  {"woman_medium_dark_skin_tone", "\U0001F469\U0001F3FE", 1},
-  {"woman_dark_skin_tone", "\U0001F469\U0001F3FF", 1},
-  {"woman_red_hair", "\U0001F469\U0000200D\U0001F9B0", 11},
-  {"woman_light_skin_tone_red_hair", "\U0001F469\U0001F3FB\U0000200D\U0001F9B0", 11},
-  {"woman_medium_light_skin_tone_red_hair", "\U0001F469\U0001F3FC\U0000200D\U0001F9B0", 11},
-  {"woman_medium_skin_tone_red_hair", "\U0001F469\U0001F3FD\U0000200D\U0001F9B0", 11},
-  {"woman_medium_dark_skin_tone_red_hair", "\U0001F469\U0001F3FE\U0000200D\U0001F9B0", 11},
-  {"woman_dark_skin_tone_red_hair", "\U0001F469\U0001F3FF\U0000200D\U0001F9B0", 11},
-  {"person_red_hair", "\U0001F9D1\U0000200D\U0001F9B0", 12},
-  {"person_light_skin_tone_red_hair", "\U0001F9D1\U0001F3FB\U0000200D\U0001F9B0", 12},
-  {"person_medium_light_skin_tone_red_hair", "\U0001F9D1\U0001F3FC\U0000200D\U0001F9B0", 12},
-  {"person_medium_skin_tone_red_hair", "\U0001F9D1\U0001F3FD\U0000200D\U0001F9B0", 12},
-  {"person_medium_dark_skin_tone_red_hair", "\U0001F9D1\U0001F3FE\U0000200D\U0001F9B0", 12},
-  {"person_dark_skin_tone_red_hair", "\U0001F9D1\U0001F3FF\U0000200D\U0001F9B0", 12},
-  {"woman_curly_hair", "\U0001F469\U0000200D\U0001F9B1", 11},
-  {"woman_light_skin_tone_curly_hair", "\U0001F469\U0001F3FB\U0000200D\U0001F9B1", 11},
-  {"woman_medium_light_skin_tone_curly_hair", "\U0001F469\U0001F3FC\U0000200D\U0001F9B1", 11},
-  {"woman_medium_skin_tone_curly_hair", "\U0001F469\U0001F3FD\U0000200D\U0001F9B1", 11},
-  {"woman_medium_dark_skin_tone_curly_hair", "\U0001F469\U0001F3FE\U0000200D\U0001F9B1", 11},
-  {"woman_dark_skin_tone_curly_hair", "\U0001F469\U0001F3FF\U0000200D\U0001F9B1", 11},
-  {"person_curly_hair", "\U0001F9D1\U0000200D\U0001F9B1", 12},
-  {"person_light_skin_tone_curly_hair", "\U0001F9D1\U0001F3FB\U0000200D\U0001F9B1", 12},
-  {"person_medium_light_skin_tone_curly_hair", "\U0001F9D1\U0001F3FC\U0000200D\U0001F9B1", 12},
-  {"person_medium_skin_tone_curly_hair", "\U0001F9D1\U0001F3FD\U0000200D\U0001F9B1", 12},
-  {"person_medium_dark_skin_tone_curly_hair", "\U0001F9D1\U0001F3FE\U0000200D\U0001F9B1", 12},
-  {"person_dark_skin_tone_curly_hair", "\U0001F9D1\U0001F3FF\U0000200D\U0001F9B1", 12},
-  {"woman_white_hair", "\U0001F469\U0000200D\U0001F9B3", 11},
-  {"woman_light_skin_tone_white_hair", "\U0001F469\U0001F3FB\U0000200D\U0001F9B3", 11},
-  {"woman_medium_light_skin_tone_white_hair", "\U0001F469\U0001F3FC\U0000200D\U0001F9B3", 11},
-  {"woman_medium_skin_tone_white_hair", "\U0001F469\U0001F3FD\U0000200D\U0001F9B3", 11},
-  {"woman_medium_dark_skin_tone_white_hair", "\U0001F469\U0001F3FE\U0000200D\U0001F9B3", 11},
-  {"woman_dark_skin_tone_white_hair", "\U0001F469\U0001F3FF\U0000200D\U0001F9B3", 11},
-  {"person_white_hair", "\U0001F9D1\U0000200D\U0001F9B3", 12},
-  {"person_light_skin_tone_white_hair", "\U0001F9D1\U0001F3FB\U0000200D\U0001F9B3", 12},
-  {"person_medium_light_skin_tone_white_hair", "\U0001F9D1\U0001F3FC\U0000200D\U0001F9B3", 12},
-  {"person_medium_skin_tone_white_hair", "\U0001F9D1\U0001F3FD\U0000200D\U0001F9B3", 12},
-  {"person_medium_dark_skin_tone_white_hair", "\U0001F9D1\U0001F3FE\U0000200D\U0001F9B3", 12},
-  {"person_dark_skin_tone_white_hair", "\U0001F9D1\U0001F3FF\U0000200D\U0001F9B3", 12},
-  {"woman_bald", "\U0001F469\U0000200D\U0001F9B2", 11},
-  {"woman_light_skin_tone_bald", "\U0001F469\U0001F3FB\U0000200D\U0001F9B2", 11},
-  {"woman_medium_light_skin_tone_bald", "\U0001F469\U0001F3FC\U0000200D\U0001F9B2", 11},
-  {"woman_medium_skin_tone_bald", "\U0001F469\U0001F3FD\U0000200D\U0001F9B2", 11},
-  {"woman_medium_dark_skin_tone_bald", "\U0001F469\U0001F3FE\U0000200D\U0001F9B2", 11},
-  {"woman_dark_skin_tone_bald", "\U0001F469\U0001F3FF\U0000200D\U0001F9B2", 11},
-  {"person_bald", "\U0001F9D1\U0000200D\U0001F9B2", 12},
-  {"person_light_skin_tone_bald", "\U0001F9D1\U0001F3FB\U0000200D\U0001F9B2", 12},
-  {"person_medium_light_skin_tone_bald", "\U0001F9D1\U0001F3FC\U0000200D\U0001F9B2", 12},
-  {"person_medium_skin_tone_bald", "\U0001F9D1\U0001F3FD\U0000200D\U0001F9B2", 12},
-  {"person_medium_dark_skin_tone_bald", "\U0001F9D1\U0001F3FE\U0000200D\U0001F9B2", 12},
-  {"person_dark_skin_tone_bald", "\U0001F9D1\U0001F3FF\U0000200D\U0001F9B2", 12},
-  {"woman_blond_hair", "\U0001F471\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_light_skin_tone_blond_hair", "\U0001F471\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_medium_light_skin_tone_blond_hair", "\U0001F471\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_medium_skin_tone_blond_hair", "\U0001F471\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_medium_dark_skin_tone_blond_hair", "\U0001F471\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_dark_skin_tone_blond_hair", "\U0001F471\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"man_blond_hair", "\U0001F471\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_light_skin_tone_blond_hair", "\U0001F471\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_medium_light_skin_tone_blond_hair", "\U0001F471\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_medium_skin_tone_blond_hair", "\U0001F471\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_medium_dark_skin_tone_blond_hair", "\U0001F471\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_dark_skin_tone_blond_hair", "\U0001F471\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"older_person", "\U0001F9D3", 5},
-  {"older_person_light_skin_tone", "\U0001F9D3\U0001F3FB", 5},
-  {"older_person_medium_light_skin_tone", "\U0001F9D3\U0001F3FC", 5},
-  {"older_person_medium_skin_tone", "\U0001F9D3\U0001F3FD", 5},
-  {"older_person_medium_dark_skin_tone", "\U0001F9D3\U0001F3FE", 5},
-  {"older_person_dark_skin_tone", "\U0001F9D3\U0001F3FF", 5},
-  {"old_man", "\U0001F474", 0},
-  {"old_man_light_skin_tone", "\U0001F474\U0001F3FB", 1},
-  {"old_man_medium_light_skin_tone", "\U0001F474\U0001F3FC", 1},
-  {"old_man_medium_skin_tone", "\U0001F474\U0001F3FD", 1},
-  {"old_man_medium_dark_skin_tone", "\U0001F474\U0001F3FE", 1},
-  {"old_man_dark_skin_tone", "\U0001F474\U0001F3FF", 1},
-  {"old_woman", "\U0001F475", 0},
-  {"old_woman_light_skin_tone", "\U0001F475\U0001F3FB", 1},
-  {"old_woman_medium_light_skin_tone", "\U0001F475\U0001F3FC", 1},
-  {"old_woman_medium_skin_tone", "\U0001F475\U0001F3FD", 1},
-  {"old_woman_medium_dark_skin_tone", "\U0001F475\U0001F3FE", 1},
-  {"old_woman_dark_skin_tone", "\U0001F475\U0001F3FF", 1},
-  {"person_frowning", "\U0001F64D", 0},
-  {"person_frowning_light_skin_tone", "\U0001F64D\U0001F3FB", 1},
-  {"person_frowning_medium_light_skin_tone", "\U0001F64D\U0001F3FC", 1},
-  {"person_frowning_medium_skin_tone", "\U0001F64D\U0001F3FD", 1},
-  {"person_frowning_medium_dark_skin_tone", "\U0001F64D\U0001F3FE", 1},
-  {"person_frowning_dark_skin_tone", "\U0001F64D\U0001F3FF", 1},
-  {"man_frowning", "\U0001F64D\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_frowning_light_skin_tone", "\U0001F64D\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_frowning_medium_light_skin_tone", "\U0001F64D\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_frowning_medium_skin_tone", "\U0001F64D\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_frowning_medium_dark_skin_tone", "\U0001F64D\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_frowning_dark_skin_tone", "\U0001F64D\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_frowning", "\U0001F64D\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_frowning_light_skin_tone", "\U0001F64D\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_frowning_medium_light_skin_tone", "\U0001F64D\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_frowning_medium_skin_tone", "\U0001F64D\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_frowning_medium_dark_skin_tone", "\U0001F64D\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_frowning_dark_skin_tone", "\U0001F64D\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_pouting", "\U0001F64E", 0},
-  {"person_pouting_light_skin_tone", "\U0001F64E\U0001F3FB", 1},
-  {"person_pouting_medium_light_skin_tone", "\U0001F64E\U0001F3FC", 1},
-  {"person_pouting_medium_skin_tone", "\U0001F64E\U0001F3FD", 1},
-  {"person_pouting_medium_dark_skin_tone", "\U0001F64E\U0001F3FE", 1},
-  {"person_pouting_dark_skin_tone", "\U0001F64E\U0001F3FF", 1},
-  {"man_pouting", "\U0001F64E\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_pouting_light_skin_tone", "\U0001F64E\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_pouting_medium_light_skin_tone", "\U0001F64E\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_pouting_medium_skin_tone", "\U0001F64E\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_pouting_medium_dark_skin_tone", "\U0001F64E\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_pouting_dark_skin_tone", "\U0001F64E\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_pouting", "\U0001F64E\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_pouting_light_skin_tone", "\U0001F64E\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_pouting_medium_light_skin_tone", "\U0001F64E\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_pouting_medium_skin_tone", "\U0001F64E\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_pouting_medium_dark_skin_tone", "\U0001F64E\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_pouting_dark_skin_tone", "\U0001F64E\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_gesturing_no", "\U0001F645", 0},
-  {"person_gesturing_no_light_skin_tone", "\U0001F645\U0001F3FB", 1},
-  {"person_gesturing_no_medium_light_skin_tone", "\U0001F645\U0001F3FC", 1},
-  {"person_gesturing_no_medium_skin_tone", "\U0001F645\U0001F3FD", 1},
-  {"person_gesturing_no_medium_dark_skin_tone", "\U0001F645\U0001F3FE", 1},
-  {"person_gesturing_no_dark_skin_tone", "\U0001F645\U0001F3FF", 1},
-  {"man_gesturing_no", "\U0001F645\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_no_light_skin_tone", "\U0001F645\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_no_medium_light_skin_tone", "\U0001F645\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_no_medium_skin_tone", "\U0001F645\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_no_medium_dark_skin_tone", "\U0001F645\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_no_dark_skin_tone", "\U0001F645\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_gesturing_no", "\U0001F645\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_no_light_skin_tone", "\U0001F645\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_no_medium_light_skin_tone", "\U0001F645\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_no_medium_skin_tone", "\U0001F645\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_no_medium_dark_skin_tone", "\U0001F645\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_no_dark_skin_tone", "\U0001F645\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_gesturing_ok", "\U0001F646", 0},
-  {"person_gesturing_ok_light_skin_tone", "\U0001F646\U0001F3FB", 1},
-  {"person_gesturing_ok_medium_light_skin_tone", "\U0001F646\U0001F3FC", 1},
-  {"person_gesturing_ok_medium_skin_tone", "\U0001F646\U0001F3FD", 1},
-  {"person_gesturing_ok_medium_dark_skin_tone", "\U0001F646\U0001F3FE", 1},
-  {"person_gesturing_ok_dark_skin_tone", "\U0001F646\U0001F3FF", 1},
-  {"man_gesturing_ok", "\U0001F646\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_ok_light_skin_tone", "\U0001F646\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_ok_medium_light_skin_tone", "\U0001F646\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_ok_medium_skin_tone", "\U0001F646\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_ok_medium_dark_skin_tone", "\U0001F646\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_gesturing_ok_dark_skin_tone", "\U0001F646\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_gesturing_ok", "\U0001F646\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_ok_light_skin_tone", "\U0001F646\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_ok_medium_light_skin_tone", "\U0001F646\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_ok_medium_skin_tone", "\U0001F646\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_ok_medium_dark_skin_tone", "\U0001F646\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_gesturing_ok_dark_skin_tone", "\U0001F646\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_tipping_hand", "\U0001F481", 0},
-  {"person_tipping_hand_light_skin_tone", "\U0001F481\U0001F3FB", 1},
-  {"person_tipping_hand_medium_light_skin_tone", "\U0001F481\U0001F3FC", 1},
-  {"person_tipping_hand_medium_skin_tone", "\U0001F481\U0001F3FD", 1},
-  {"person_tipping_hand_medium_dark_skin_tone", "\U0001F481\U0001F3FE", 1},
-  {"person_tipping_hand_dark_skin_tone", "\U0001F481\U0001F3FF", 1},
-  {"man_tipping_hand", "\U0001F481\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_tipping_hand_light_skin_tone", "\U0001F481\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_tipping_hand_medium_light_skin_tone", "\U0001F481\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_tipping_hand_medium_skin_tone", "\U0001F481\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_tipping_hand_medium_dark_skin_tone", "\U0001F481\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_tipping_hand_dark_skin_tone", "\U0001F481\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_tipping_hand", "\U0001F481\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_tipping_hand_light_skin_tone", "\U0001F481\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_tipping_hand_medium_light_skin_tone", "\U0001F481\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_tipping_hand_medium_skin_tone", "\U0001F481\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_tipping_hand_medium_dark_skin_tone", "\U0001F481\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_tipping_hand_dark_skin_tone", "\U0001F481\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_raising_hand", "\U0001F64B", 0},
-  {"person_raising_hand_light_skin_tone", "\U0001F64B\U0001F3FB", 1},
-  {"person_raising_hand_medium_light_skin_tone", "\U0001F64B\U0001F3FC", 1},
-  {"person_raising_hand_medium_skin_tone", "\U0001F64B\U0001F3FD", 1},
-  {"person_raising_hand_medium_dark_skin_tone", "\U0001F64B\U0001F3FE", 1},
-  {"person_raising_hand_dark_skin_tone", "\U0001F64B\U0001F3FF", 1},
-  {"man_raising_hand", "\U0001F64B\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_raising_hand_light_skin_tone", "\U0001F64B\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_raising_hand_medium_light_skin_tone", "\U0001F64B\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_raising_hand_medium_skin_tone", "\U0001F64B\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_raising_hand_medium_dark_skin_tone", "\U0001F64B\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_raising_hand_dark_skin_tone", "\U0001F64B\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_raising_hand", "\U0001F64B\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_raising_hand_light_skin_tone", "\U0001F64B\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_raising_hand_medium_light_skin_tone", "\U0001F64B\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_raising_hand_medium_skin_tone", "\U0001F64B\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_raising_hand_medium_dark_skin_tone", "\U0001F64B\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_raising_hand_dark_skin_tone", "\U0001F64B\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"deaf_person", "\U0001F9CF", 12},
-  {"deaf_person_light_skin_tone", "\U0001F9CF\U0001F3FB", 12},
-  {"deaf_person_medium_light_skin_tone", "\U0001F9CF\U0001F3FC", 12},
-  {"deaf_person_medium_skin_tone", "\U0001F9CF\U0001F3FD", 12},
-  {"deaf_person_medium_dark_skin_tone", "\U0001F9CF\U0001F3FE", 12},
-  {"deaf_person_dark_skin_tone", "\U0001F9CF\U0001F3FF", 12},
-  {"deaf_man", "\U0001F9CF\U0000200D\U00002642\U0000FE0F", 12},
-  {"deaf_man_light_skin_tone", "\U0001F9CF\U0001F3FB\U0000200D\U00002642\U0000FE0F", 12},
-  {"deaf_man_medium_light_skin_tone", "\U0001F9CF\U0001F3FC\U0000200D\U00002642\U0000FE0F", 12},
-  {"deaf_man_medium_skin_tone", "\U0001F9CF\U0001F3FD\U0000200D\U00002642\U0000FE0F", 12},
-  {"deaf_man_medium_dark_skin_tone", "\U0001F9CF\U0001F3FE\U0000200D\U00002642\U0000FE0F", 12},
-  {"deaf_man_dark_skin_tone", "\U0001F9CF\U0001F3FF\U0000200D\U00002642\U0000FE0F", 12},
-  {"deaf_woman", "\U0001F9CF\U0000200D\U00002640\U0000FE0F", 12},
-  {"deaf_woman_light_skin_tone", "\U0001F9CF\U0001F3FB\U0000200D\U00002640\U0000FE0F", 12},
-  {"deaf_woman_medium_light_skin_tone", "\U0001F9CF\U0001F3FC\U0000200D\U00002640\U0000FE0F", 12},
-  {"deaf_woman_medium_skin_tone", "\U0001F9CF\U0001F3FD\U0000200D\U00002640\U0000FE0F", 12},
-  {"deaf_woman_medium_dark_skin_tone", "\U0001F9CF\U0001F3FE\U0000200D\U00002640\U0000FE0F", 12},
-  {"deaf_woman_dark_skin_tone", "\U0001F9CF\U0001F3FF\U0000200D\U00002640\U0000FE0F", 12},
-  {"person_bowing", "\U0001F647", 0},
-  {"person_bowing_light_skin_tone", "\U0001F647\U0001F3FB", 1},
-  {"person_bowing_medium_light_skin_tone", "\U0001F647\U0001F3FC", 1},
-  {"person_bowing_medium_skin_tone", "\U0001F647\U0001F3FD", 1},
-  {"person_bowing_medium_dark_skin_tone", "\U0001F647\U0001F3FE", 1},
-  {"person_bowing_dark_skin_tone", "\U0001F647\U0001F3FF", 1},
-  {"man_bowing", "\U0001F647\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bowing_light_skin_tone", "\U0001F647\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bowing_medium_light_skin_tone", "\U0001F647\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bowing_medium_skin_tone", "\U0001F647\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bowing_medium_dark_skin_tone", "\U0001F647\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bowing_dark_skin_tone", "\U0001F647\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_bowing", "\U0001F647\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bowing_light_skin_tone", "\U0001F647\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bowing_medium_light_skin_tone", "\U0001F647\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bowing_medium_skin_tone", "\U0001F647\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bowing_medium_dark_skin_tone", "\U0001F647\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bowing_dark_skin_tone", "\U0001F647\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_facepalming", "\U0001F926", 3},
-  {"person_facepalming_light_skin_tone", "\U0001F926\U0001F3FB", 3},
-  {"person_facepalming_medium_light_skin_tone", "\U0001F926\U0001F3FC", 3},
-  {"person_facepalming_medium_skin_tone", "\U0001F926\U0001F3FD", 3},
-  {"person_facepalming_medium_dark_skin_tone", "\U0001F926\U0001F3FE", 3},
-  {"person_facepalming_dark_skin_tone", "\U0001F926\U0001F3FF", 3},
-  {"man_facepalming", "\U0001F926\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_facepalming_light_skin_tone", "\U0001F926\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_facepalming_medium_light_skin_tone", "\U0001F926\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_facepalming_medium_skin_tone", "\U0001F926\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_facepalming_medium_dark_skin_tone", "\U0001F926\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_facepalming_dark_skin_tone", "\U0001F926\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_facepalming", "\U0001F926\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_facepalming_light_skin_tone", "\U0001F926\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_facepalming_medium_light_skin_tone", "\U0001F926\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_facepalming_medium_skin_tone", "\U0001F926\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_facepalming_medium_dark_skin_tone", "\U0001F926\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_facepalming_dark_skin_tone", "\U0001F926\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_shrugging", "\U0001F937", 3},
-  {"person_shrugging_light_skin_tone", "\U0001F937\U0001F3FB", 3},
-  {"person_shrugging_medium_light_skin_tone", "\U0001F937\U0001F3FC", 3},
-  {"person_shrugging_medium_skin_tone", "\U0001F937\U0001F3FD", 3},
-  {"person_shrugging_medium_dark_skin_tone", "\U0001F937\U0001F3FE", 3},
-  {"person_shrugging_dark_skin_tone", "\U0001F937\U0001F3FF", 3},
-  {"man_shrugging", "\U0001F937\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_shrugging_light_skin_tone", "\U0001F937\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_shrugging_medium_light_skin_tone", "\U0001F937\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_shrugging_medium_skin_tone", "\U0001F937\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_shrugging_medium_dark_skin_tone", "\U0001F937\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_shrugging_dark_skin_tone", "\U0001F937\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_shrugging", "\U0001F937\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_shrugging_light_skin_tone", "\U0001F937\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_shrugging_medium_light_skin_tone", "\U0001F937\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_shrugging_medium_skin_tone", "\U0001F937\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_shrugging_medium_dark_skin_tone", "\U0001F937\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_shrugging_dark_skin_tone", "\U0001F937\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"health_worker", "\U0001F9D1\U0000200D\U00002695\U0000FE0F", 12},
-  {"health_worker_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002695\U0000FE0F", 12},
-  {"health_worker_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002695\U0000FE0F", 12},
-  {"health_worker_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002695\U0000FE0F", 12},
-  {"health_worker_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002695\U0000FE0F", 12},
-  {"health_worker_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002695\U0000FE0F", 12},
-  {"man_health_worker", "\U0001F468\U0000200D\U00002695\U0000FE0F", 4},
-  {"man_health_worker_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002695\U0000FE0F", 4},
-  {"man_health_worker_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002695\U0000FE0F", 4},
-  {"man_health_worker_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002695\U0000FE0F", 4},
-  {"man_health_worker_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002695\U0000FE0F", 4},
-  {"man_health_worker_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002695\U0000FE0F", 4},
-  {"woman_health_worker", "\U0001F469\U0000200D\U00002695\U0000FE0F", 4},
-  {"woman_health_worker_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002695\U0000FE0F", 4},
-  {"woman_health_worker_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002695\U0000FE0F", 4},
-  {"woman_health_worker_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002695\U0000FE0F", 4},
-  {"woman_health_worker_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002695\U0000FE0F", 4},
-  {"woman_health_worker_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002695\U0000FE0F", 4},
-  {"student", "\U0001F9D1\U0000200D\U0001F393", 12},
-  {"student_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F393", 12},
-  {"student_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F393", 12},
-  {"student_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F393", 12},
-  {"student_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F393", 12},
-  {"student_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F393", 12},
-  {"man_student", "\U0001F468\U0000200D\U0001F393", 4},
-  {"man_student_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F393", 4},
-  {"man_student_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F393", 4},
-  {"man_student_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F393", 4},
-  {"man_student_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F393", 4},
-  {"man_student_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F393", 4},
-  {"woman_student", "\U0001F469\U0000200D\U0001F393", 4},
-  {"woman_student_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F393", 4},
-  {"woman_student_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F393", 4},
-  {"woman_student_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F393", 4},
-  {"woman_student_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F393", 4},
-  {"woman_student_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F393", 4},
-  {"teacher", "\U0001F9D1\U0000200D\U0001F3EB", 12},
-  {"teacher_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F3EB", 12},
-  {"teacher_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F3EB", 12},
-  {"teacher_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F3EB", 12},
-  {"teacher_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F3EB", 12},
-  {"teacher_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F3EB", 12},
-  {"man_teacher", "\U0001F468\U0000200D\U0001F3EB", 4},
-  {"man_teacher_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F3EB", 4},
-  {"man_teacher_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F3EB", 4},
-  {"man_teacher_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F3EB", 4},
-  {"man_teacher_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F3EB", 4},
-  {"man_teacher_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F3EB", 4},
-  {"woman_teacher", "\U0001F469\U0000200D\U0001F3EB", 4},
-  {"woman_teacher_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F3EB", 4},
-  {"woman_teacher_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F3EB", 4},
-  {"woman_teacher_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F3EB", 4},
-  {"woman_teacher_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F3EB", 4},
-  {"woman_teacher_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F3EB", 4},
-  {"judge", "\U0001F9D1\U0000200D\U00002696\U0000FE0F", 12},
-  {"judge_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002696\U0000FE0F", 12},
-  {"judge_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002696\U0000FE0F", 12},
-  {"judge_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002696\U0000FE0F", 12},
-  {"judge_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002696\U0000FE0F", 12},
-  {"judge_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002696\U0000FE0F", 12},
-  {"man_judge", "\U0001F468\U0000200D\U00002696\U0000FE0F", 4},
-  {"man_judge_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002696\U0000FE0F", 4},
-  {"man_judge_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002696\U0000FE0F", 4},
-  {"man_judge_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002696\U0000FE0F", 4},
-  {"man_judge_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002696\U0000FE0F", 4},
-  {"man_judge_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002696\U0000FE0F", 4},
-  {"woman_judge", "\U0001F469\U0000200D\U00002696\U0000FE0F", 4},
-  {"woman_judge_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002696\U0000FE0F", 4},
-  {"woman_judge_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002696\U0000FE0F", 4},
-  {"woman_judge_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002696\U0000FE0F", 4},
-  {"woman_judge_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002696\U0000FE0F", 4},
-  {"woman_judge_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002696\U0000FE0F", 4},
-  {"farmer", "\U0001F9D1\U0000200D\U0001F33E", 12},
-  {"farmer_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F33E", 12},
-  {"farmer_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F33E", 12},
-  {"farmer_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F33E", 12},
-  {"farmer_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F33E", 12},
-  {"farmer_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F33E", 12},
-  {"man_farmer", "\U0001F468\U0000200D\U0001F33E", 4},
-  {"man_farmer_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F33E", 4},
-  {"man_farmer_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F33E", 4},
-  {"man_farmer_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F33E", 4},
-  {"man_farmer_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F33E", 4},
-  {"man_farmer_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F33E", 4},
-  {"woman_farmer", "\U0001F469\U0000200D\U0001F33E", 4},
-  {"woman_farmer_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F33E", 4},
-  {"woman_farmer_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F33E", 4},
-  {"woman_farmer_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F33E", 4},
-  {"woman_farmer_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F33E", 4},
-  {"woman_farmer_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F33E", 4},
-  {"cook", "\U0001F9D1\U0000200D\U0001F373", 12},
-  {"cook_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F373", 12},
-  {"cook_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F373", 12},
-  {"cook_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F373", 12},
-  {"cook_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F373", 12},
-  {"cook_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F373", 12},
-  {"man_cook", "\U0001F468\U0000200D\U0001F373", 4},
-  {"man_cook_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F373", 4},
-  {"man_cook_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F373", 4},
-  {"man_cook_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F373", 4},
-  {"man_cook_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F373", 4},
-  {"man_cook_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F373", 4},
-  {"woman_cook", "\U0001F469\U0000200D\U0001F373", 4},
-  {"woman_cook_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F373", 4},
-  {"woman_cook_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F373", 4},
-  {"woman_cook_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F373", 4},
-  {"woman_cook_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F373", 4},
-  {"woman_cook_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F373", 4},
-  {"mechanic", "\U0001F9D1\U0000200D\U0001F527", 12},
-  {"mechanic_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F527", 12},
-  {"mechanic_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F527", 12},
-  {"mechanic_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F527", 12},
-  {"mechanic_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F527", 12},
-  {"mechanic_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F527", 12},
-  {"man_mechanic", "\U0001F468\U0000200D\U0001F527", 4},
-  {"man_mechanic_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F527", 4},
-  {"man_mechanic_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F527", 4},
-  {"man_mechanic_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F527", 4},
-  {"man_mechanic_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F527", 4},
-  {"man_mechanic_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F527", 4},
-  {"woman_mechanic", "\U0001F469\U0000200D\U0001F527", 4},
-  {"woman_mechanic_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F527", 4},
-  {"woman_mechanic_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F527", 4},
-  {"woman_mechanic_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F527", 4},
-  {"woman_mechanic_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F527", 4},
-  {"woman_mechanic_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F527", 4},
-  {"factory_worker", "\U0001F9D1\U0000200D\U0001F3ED", 12},
-  {"factory_worker_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F3ED", 12},
-  {"factory_worker_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F3ED", 12},
-  {"factory_worker_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F3ED", 12},
-  {"factory_worker_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F3ED", 12},
-  {"factory_worker_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F3ED", 12},
-  {"man_factory_worker", "\U0001F468\U0000200D\U0001F3ED", 4},
-  {"man_factory_worker_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F3ED", 4},
-  {"man_factory_worker_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F3ED", 4},
-  {"man_factory_worker_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F3ED", 4},
-  {"man_factory_worker_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F3ED", 4},
-  {"man_factory_worker_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F3ED", 4},
-  {"woman_factory_worker", "\U0001F469\U0000200D\U0001F3ED", 4},
-  {"woman_factory_worker_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F3ED", 4},
-  {"woman_factory_worker_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F3ED", 4},
-  {"woman_factory_worker_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F3ED", 4},
-  {"woman_factory_worker_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F3ED", 4},
-  {"woman_factory_worker_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F3ED", 4},
-  {"office_worker", "\U0001F9D1\U0000200D\U0001F4BC", 12},
-  {"office_worker_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F4BC", 12},
-  {"office_worker_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F4BC", 12},
-  {"office_worker_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F4BC", 12},
-  {"office_worker_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F4BC", 12},
-  {"office_worker_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F4BC", 12},
-  {"man_office_worker", "\U0001F468\U0000200D\U0001F4BC", 4},
-  {"man_office_worker_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F4BC", 4},
-  {"man_office_worker_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F4BC", 4},
-  {"man_office_worker_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F4BC", 4},
-  {"man_office_worker_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F4BC", 4},
-  {"man_office_worker_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F4BC", 4},
-  {"woman_office_worker", "\U0001F469\U0000200D\U0001F4BC", 4},
-  {"woman_office_worker_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F4BC", 4},
-  {"woman_office_worker_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F4BC", 4},
-  {"woman_office_worker_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F4BC", 4},
-  {"woman_office_worker_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F4BC", 4},
-  {"woman_office_worker_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F4BC", 4},
-  {"scientist", "\U0001F9D1\U0000200D\U0001F52C", 12},
-  {"scientist_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F52C", 12},
-  {"scientist_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F52C", 12},
-  {"scientist_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F52C", 12},
-  {"scientist_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F52C", 12},
-  {"scientist_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F52C", 12},
-  {"man_scientist", "\U0001F468\U0000200D\U0001F52C", 4},
-  {"man_scientist_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F52C", 4},
-  {"man_scientist_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F52C", 4},
-  {"man_scientist_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F52C", 4},
-  {"man_scientist_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F52C", 4},
-  {"man_scientist_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F52C", 4},
-  {"woman_scientist", "\U0001F469\U0000200D\U0001F52C", 4},
-  {"woman_scientist_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F52C", 4},
-  {"woman_scientist_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F52C", 4},
-  {"woman_scientist_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F52C", 4},
-  {"woman_scientist_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F52C", 4},
-  {"woman_scientist_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F52C", 4},
-  {"technologist", "\U0001F9D1\U0000200D\U0001F4BB", 12},
-  {"technologist_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F4BB", 12},
-  {"technologist_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F4BB", 12},
-  {"technologist_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F4BB", 12},
-  {"technologist_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F4BB", 12},
-  {"technologist_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F4BB", 12},
-  {"man_technologist", "\U0001F468\U0000200D\U0001F4BB", 4},
-  {"man_technologist_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F4BB", 4},
-  {"man_technologist_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F4BB", 4},
-  {"man_technologist_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F4BB", 4},
-  {"man_technologist_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F4BB", 4},
-  {"man_technologist_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F4BB", 4},
-  {"woman_technologist", "\U0001F469\U0000200D\U0001F4BB", 4},
-  {"woman_technologist_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F4BB", 4},
-  {"woman_technologist_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F4BB", 4},
-  {"woman_technologist_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F4BB", 4},
-  {"woman_technologist_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F4BB", 4},
-  {"woman_technologist_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F4BB", 4},
-  {"singer", "\U0001F9D1\U0000200D\U0001F3A4", 12},
-  {"singer_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F3A4", 12},
-  {"singer_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F3A4", 12},
-  {"singer_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F3A4", 12},
-  {"singer_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F3A4", 12},
-  {"singer_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F3A4", 12},
-  {"man_singer", "\U0001F468\U0000200D\U0001F3A4", 4},
-  {"man_singer_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F3A4", 4},
-  {"man_singer_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F3A4", 4},
-  {"man_singer_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F3A4", 4},
-  {"man_singer_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F3A4", 4},
-  {"man_singer_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F3A4", 4},
-  {"woman_singer", "\U0001F469\U0000200D\U0001F3A4", 4},
-  {"woman_singer_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F3A4", 4},
-  {"woman_singer_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F3A4", 4},
-  {"woman_singer_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F3A4", 4},
-  {"woman_singer_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F3A4", 4},
-  {"woman_singer_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F3A4", 4},
-  {"artist", "\U0001F9D1\U0000200D\U0001F3A8", 12},
-  {"artist_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F3A8", 12},
-  {"artist_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F3A8", 12},
-  {"artist_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F3A8", 12},
-  {"artist_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F3A8", 12},
-  {"artist_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F3A8", 12},
-  {"man_artist", "\U0001F468\U0000200D\U0001F3A8", 4},
-  {"man_artist_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F3A8", 4},
-  {"man_artist_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F3A8", 4},
-  {"man_artist_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F3A8", 4},
-  {"man_artist_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F3A8", 4},
-  {"man_artist_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F3A8", 4},
-  {"woman_artist", "\U0001F469\U0000200D\U0001F3A8", 4},
-  {"woman_artist_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F3A8", 4},
-  {"woman_artist_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F3A8", 4},
-  {"woman_artist_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F3A8", 4},
-  {"woman_artist_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F3A8", 4},
-  {"woman_artist_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F3A8", 4},
-  {"pilot", "\U0001F9D1\U0000200D\U00002708\U0000FE0F", 12},
-  {"pilot_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002708\U0000FE0F", 12},
-  {"pilot_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002708\U0000FE0F", 12},
-  {"pilot_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002708\U0000FE0F", 12},
-  {"pilot_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002708\U0000FE0F", 12},
-  {"pilot_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002708\U0000FE0F", 12},
-  {"man_pilot", "\U0001F468\U0000200D\U00002708\U0000FE0F", 4},
-  {"man_pilot_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002708\U0000FE0F", 4},
-  {"man_pilot_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002708\U0000FE0F", 4},
-  {"man_pilot_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002708\U0000FE0F", 4},
-  {"man_pilot_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002708\U0000FE0F", 4},
-  {"man_pilot_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002708\U0000FE0F", 4},
-  {"woman_pilot", "\U0001F469\U0000200D\U00002708\U0000FE0F", 4},
-  {"woman_pilot_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002708\U0000FE0F", 4},
-  {"woman_pilot_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002708\U0000FE0F", 4},
-  {"woman_pilot_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002708\U0000FE0F", 4},
-  {"woman_pilot_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002708\U0000FE0F", 4},
-  {"woman_pilot_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002708\U0000FE0F", 4},
-  {"astronaut", "\U0001F9D1\U0000200D\U0001F680", 12},
-  {"astronaut_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F680", 12},
-  {"astronaut_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F680", 12},
-  {"astronaut_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F680", 12},
-  {"astronaut_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F680", 12},
-  {"astronaut_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F680", 12},
-  {"man_astronaut", "\U0001F468\U0000200D\U0001F680", 4},
-  {"man_astronaut_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F680", 4},
-  {"man_astronaut_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F680", 4},
-  {"man_astronaut_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F680", 4},
-  {"man_astronaut_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F680", 4},
-  {"man_astronaut_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F680", 4},
-  {"woman_astronaut", "\U0001F469\U0000200D\U0001F680", 4},
-  {"woman_astronaut_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F680", 4},
-  {"woman_astronaut_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F680", 4},
-  {"woman_astronaut_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F680", 4},
-  {"woman_astronaut_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F680", 4},
-  {"woman_astronaut_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F680", 4},
-  {"firefighter", "\U0001F9D1\U0000200D\U0001F692", 12},
-  {"firefighter_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F692", 12},
-  {"firefighter_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F692", 12},
-  {"firefighter_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F692", 12},
-  {"firefighter_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F692", 12},
-  {"firefighter_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F692", 12},
-  {"man_firefighter", "\U0001F468\U0000200D\U0001F692", 4},
-  {"man_firefighter_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F692", 4},
-  {"man_firefighter_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F692", 4},
-  {"man_firefighter_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F692", 4},
-  {"man_firefighter_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F692", 4},
-  {"man_firefighter_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F692", 4},
-  {"woman_firefighter", "\U0001F469\U0000200D\U0001F692", 4},
-  {"woman_firefighter_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F692", 4},
-  {"woman_firefighter_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F692", 4},
-  {"woman_firefighter_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F692", 4},
-  {"woman_firefighter_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F692", 4},
-  {"woman_firefighter_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F692", 4},
-  {"police_officer", "\U0001F46E", 0},
-  {"police_officer_light_skin_tone", "\U0001F46E\U0001F3FB", 1},
-  {"police_officer_medium_light_skin_tone", "\U0001F46E\U0001F3FC", 1},
-  {"police_officer_medium_skin_tone", "\U0001F46E\U0001F3FD", 1},
-  {"police_officer_medium_dark_skin_tone", "\U0001F46E\U0001F3FE", 1},
-  {"police_officer_dark_skin_tone", "\U0001F46E\U0001F3FF", 1},
-  {"man_police_officer", "\U0001F46E\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_police_officer_light_skin_tone", "\U0001F46E\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_police_officer_medium_light_skin_tone", "\U0001F46E\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_police_officer_medium_skin_tone", "\U0001F46E\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_police_officer_medium_dark_skin_tone", "\U0001F46E\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_police_officer_dark_skin_tone", "\U0001F46E\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_police_officer", "\U0001F46E\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_police_officer_light_skin_tone", "\U0001F46E\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_police_officer_medium_light_skin_tone", "\U0001F46E\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_police_officer_medium_skin_tone", "\U0001F46E\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_police_officer_medium_dark_skin_tone", "\U0001F46E\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_police_officer_dark_skin_tone", "\U0001F46E\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"detective", "\U0001F575", 0},
-  {"detective_light_skin_tone", "\U0001F575\U0001F3FB", 2},
-  {"detective_medium_light_skin_tone", "\U0001F575\U0001F3FC", 2},
-  {"detective_medium_skin_tone", "\U0001F575\U0001F3FD", 2},
-  {"detective_medium_dark_skin_tone", "\U0001F575\U0001F3FE", 2},
-  {"detective_dark_skin_tone", "\U0001F575\U0001F3FF", 2},
-  {"man_detective", "\U0001F575\U0000FE0F\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_detective_light_skin_tone", "\U0001F575\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_detective_medium_light_skin_tone", "\U0001F575\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_detective_medium_skin_tone", "\U0001F575\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_detective_medium_dark_skin_tone", "\U0001F575\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_detective_dark_skin_tone", "\U0001F575\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_detective", "\U0001F575\U0000FE0F\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_detective_light_skin_tone", "\U0001F575\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_detective_medium_light_skin_tone", "\U0001F575\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_detective_medium_skin_tone", "\U0001F575\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_detective_medium_dark_skin_tone", "\U0001F575\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_detective_dark_skin_tone", "\U0001F575\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"guard", "\U0001F482", 0},
-  {"guard_light_skin_tone", "\U0001F482\U0001F3FB", 1},
-  {"guard_medium_light_skin_tone", "\U0001F482\U0001F3FC", 1},
-  {"guard_medium_skin_tone", "\U0001F482\U0001F3FD", 1},
-  {"guard_medium_dark_skin_tone", "\U0001F482\U0001F3FE", 1},
-  {"guard_dark_skin_tone", "\U0001F482\U0001F3FF", 1},
-  {"man_guard", "\U0001F482\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_guard_light_skin_tone", "\U0001F482\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_guard_medium_light_skin_tone", "\U0001F482\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_guard_medium_skin_tone", "\U0001F482\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_guard_medium_dark_skin_tone", "\U0001F482\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_guard_dark_skin_tone", "\U0001F482\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_guard", "\U0001F482\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_guard_light_skin_tone", "\U0001F482\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_guard_medium_light_skin_tone", "\U0001F482\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_guard_medium_skin_tone", "\U0001F482\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_guard_medium_dark_skin_tone", "\U0001F482\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_guard_dark_skin_tone", "\U0001F482\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"ninja", "\U0001F977", 13},
-  {"ninja_light_skin_tone", "\U0001F977\U0001F3FB", 13},
-  {"ninja_medium_light_skin_tone", "\U0001F977\U0001F3FC", 13},
-  {"ninja_medium_skin_tone", "\U0001F977\U0001F3FD", 13},
-  {"ninja_medium_dark_skin_tone", "\U0001F977\U0001F3FE", 13},
-  {"ninja_dark_skin_tone", "\U0001F977\U0001F3FF", 13},
-  {"construction_worker", "\U0001F477", 0},
-  {"construction_worker_light_skin_tone", "\U0001F477\U0001F3FB", 1},
-  {"construction_worker_medium_light_skin_tone", "\U0001F477\U0001F3FC", 1},
-  {"construction_worker_medium_skin_tone", "\U0001F477\U0001F3FD", 1},
-  {"construction_worker_medium_dark_skin_tone", "\U0001F477\U0001F3FE", 1},
-  {"construction_worker_dark_skin_tone", "\U0001F477\U0001F3FF", 1},
-  {"man_construction_worker", "\U0001F477\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_construction_worker_light_skin_tone", "\U0001F477\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_construction_worker_medium_light_skin_tone", "\U0001F477\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_construction_worker_medium_skin_tone", "\U0001F477\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_construction_worker_medium_dark_skin_tone", "\U0001F477\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_construction_worker_dark_skin_tone", "\U0001F477\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_construction_worker", "\U0001F477\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_construction_worker_light_skin_tone", "\U0001F477\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_construction_worker_medium_light_skin_tone", "\U0001F477\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_construction_worker_medium_skin_tone", "\U0001F477\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_construction_worker_medium_dark_skin_tone", "\U0001F477\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_construction_worker_dark_skin_tone", "\U0001F477\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_with_crown", "\U0001FAC5", 14},
-  {"person_with_crown_light_skin_tone", "\U0001FAC5\U0001F3FB", 14},
-  {"person_with_crown_medium_light_skin_tone", "\U0001FAC5\U0001F3FC", 14},
-  {"person_with_crown_medium_skin_tone", "\U0001FAC5\U0001F3FD", 14},
-  {"person_with_crown_medium_dark_skin_tone", "\U0001FAC5\U0001F3FE", 14},
-  {"person_with_crown_dark_skin_tone", "\U0001FAC5\U0001F3FF", 14},
-  {"prince", "\U0001F934", 3},
-  {"prince_light_skin_tone", "\U0001F934\U0001F3FB", 3},
-  {"prince_medium_light_skin_tone", "\U0001F934\U0001F3FC", 3},
-  {"prince_medium_skin_tone", "\U0001F934\U0001F3FD", 3},
-  {"prince_medium_dark_skin_tone", "\U0001F934\U0001F3FE", 3},
-  {"prince_dark_skin_tone", "\U0001F934\U0001F3FF", 3},
-  {"princess", "\U0001F478", 0},
-  {"princess_light_skin_tone", "\U0001F478\U0001F3FB", 1},
-  {"princess_medium_light_skin_tone", "\U0001F478\U0001F3FC", 1},
-  {"princess_medium_skin_tone", "\U0001F478\U0001F3FD", 1},
-  {"princess_medium_dark_skin_tone", "\U0001F478\U0001F3FE", 1},
-  {"princess_dark_skin_tone", "\U0001F478\U0001F3FF", 1},
-  {"person_wearing_turban", "\U0001F473", 0},
-  {"person_wearing_turban_light_skin_tone", "\U0001F473\U0001F3FB", 1},
-  {"person_wearing_turban_medium_light_skin_tone", "\U0001F473\U0001F3FC", 1},
-  {"person_wearing_turban_medium_skin_tone", "\U0001F473\U0001F3FD", 1},
-  {"person_wearing_turban_medium_dark_skin_tone", "\U0001F473\U0001F3FE", 1},
-  {"person_wearing_turban_dark_skin_tone", "\U0001F473\U0001F3FF", 1},
-  {"man_wearing_turban", "\U0001F473\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_wearing_turban_light_skin_tone", "\U0001F473\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_wearing_turban_medium_light_skin_tone", "\U0001F473\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_wearing_turban_medium_skin_tone", "\U0001F473\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_wearing_turban_medium_dark_skin_tone", "\U0001F473\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_wearing_turban_dark_skin_tone", "\U0001F473\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_wearing_turban", "\U0001F473\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_wearing_turban_light_skin_tone", "\U0001F473\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_wearing_turban_medium_light_skin_tone", "\U0001F473\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_wearing_turban_medium_skin_tone", "\U0001F473\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_wearing_turban_medium_dark_skin_tone", "\U0001F473\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_wearing_turban_dark_skin_tone", "\U0001F473\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_with_skullcap", "\U0001F472", 0},
-  {"person_with_skullcap_light_skin_tone", "\U0001F472\U0001F3FB", 1},
-  {"person_with_skullcap_medium_light_skin_tone", "\U0001F472\U0001F3FC", 1},
-  {"person_with_skullcap_medium_skin_tone", "\U0001F472\U0001F3FD", 1},
-  {"person_with_skullcap_medium_dark_skin_tone", "\U0001F472\U0001F3FE", 1},
-  {"person_with_skullcap_dark_skin_tone", "\U0001F472\U0001F3FF", 1},
-  {"woman_with_headscarf", "\U0001F9D5", 5},
-  {"woman_with_headscarf_light_skin_tone", "\U0001F9D5\U0001F3FB", 5},
-  {"woman_with_headscarf_medium_light_skin_tone", "\U0001F9D5\U0001F3FC", 5},
-  {"woman_with_headscarf_medium_skin_tone", "\U0001F9D5\U0001F3FD", 5},
-  {"woman_with_headscarf_medium_dark_skin_tone", "\U0001F9D5\U0001F3FE", 5},
-  {"woman_with_headscarf_dark_skin_tone", "\U0001F9D5\U0001F3FF", 5},
-  {"person_in_tuxedo", "\U0001F935", 3},
-  {"person_in_tuxedo_light_skin_tone", "\U0001F935\U0001F3FB", 3},
-  {"person_in_tuxedo_medium_light_skin_tone", "\U0001F935\U0001F3FC", 3},
-  {"person_in_tuxedo_medium_skin_tone", "\U0001F935\U0001F3FD", 3},
-  {"person_in_tuxedo_medium_dark_skin_tone", "\U0001F935\U0001F3FE", 3},
-  {"person_in_tuxedo_dark_skin_tone", "\U0001F935\U0001F3FF", 3},
-  {"man_in_tuxedo", "\U0001F935\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_in_tuxedo_light_skin_tone", "\U0001F935\U0001F3FB\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_in_tuxedo_medium_light_skin_tone", "\U0001F935\U0001F3FC\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_in_tuxedo_medium_skin_tone", "\U0001F935\U0001F3FD\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_in_tuxedo_medium_dark_skin_tone", "\U0001F935\U0001F3FE\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_in_tuxedo_dark_skin_tone", "\U0001F935\U0001F3FF\U0000200D\U00002642\U0000FE0F", 13},
-  {"woman_in_tuxedo", "\U0001F935\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_in_tuxedo_light_skin_tone", "\U0001F935\U0001F3FB\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_in_tuxedo_medium_light_skin_tone", "\U0001F935\U0001F3FC\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_in_tuxedo_medium_skin_tone", "\U0001F935\U0001F3FD\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_in_tuxedo_medium_dark_skin_tone", "\U0001F935\U0001F3FE\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_in_tuxedo_dark_skin_tone", "\U0001F935\U0001F3FF\U0000200D\U00002640\U0000FE0F", 13},
-  {"person_with_veil", "\U0001F470", 0},
-  {"person_with_veil_light_skin_tone", "\U0001F470\U0001F3FB", 1},
-  {"person_with_veil_medium_light_skin_tone", "\U0001F470\U0001F3FC", 1},
-  {"person_with_veil_medium_skin_tone", "\U0001F470\U0001F3FD", 1},
-  {"person_with_veil_medium_dark_skin_tone", "\U0001F470\U0001F3FE", 1},
-  {"person_with_veil_dark_skin_tone", "\U0001F470\U0001F3FF", 1},
-  {"man_with_veil", "\U0001F470\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_with_veil_light_skin_tone", "\U0001F470\U0001F3FB\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_with_veil_medium_light_skin_tone", "\U0001F470\U0001F3FC\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_with_veil_medium_skin_tone", "\U0001F470\U0001F3FD\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_with_veil_medium_dark_skin_tone", "\U0001F470\U0001F3FE\U0000200D\U00002642\U0000FE0F", 13},
-  {"man_with_veil_dark_skin_tone", "\U0001F470\U0001F3FF\U0000200D\U00002642\U0000FE0F", 13},
-  {"woman_with_veil", "\U0001F470\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_with_veil_light_skin_tone", "\U0001F470\U0001F3FB\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_with_veil_medium_light_skin_tone", "\U0001F470\U0001F3FC\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_with_veil_medium_skin_tone", "\U0001F470\U0001F3FD\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_with_veil_medium_dark_skin_tone", "\U0001F470\U0001F3FE\U0000200D\U00002640\U0000FE0F", 13},
-  {"woman_with_veil_dark_skin_tone", "\U0001F470\U0001F3FF\U0000200D\U00002640\U0000FE0F", 13},
-  {"pregnant_woman", "\U0001F930", 3},
-  {"pregnant_woman_light_skin_tone", "\U0001F930\U0001F3FB", 3},
-  {"pregnant_woman_medium_light_skin_tone", "\U0001F930\U0001F3FC", 3},
-  {"pregnant_woman_medium_skin_tone", "\U0001F930\U0001F3FD", 3},
-  {"pregnant_woman_medium_dark_skin_tone", "\U0001F930\U0001F3FE", 3},
-  {"pregnant_woman_dark_skin_tone", "\U0001F930\U0001F3FF", 3},
-  {"pregnant_man", "\U0001FAC3", 14},
-  {"pregnant_man_light_skin_tone", "\U0001FAC3\U0001F3FB", 14},
-  {"pregnant_man_medium_light_skin_tone", "\U0001FAC3\U0001F3FC", 14},
-  {"pregnant_man_medium_skin_tone", "\U0001FAC3\U0001F3FD", 14},
-  {"pregnant_man_medium_dark_skin_tone", "\U0001FAC3\U0001F3FE", 14},
-  {"pregnant_man_dark_skin_tone", "\U0001FAC3\U0001F3FF", 14},
-  {"pregnant_person", "\U0001FAC4", 14},
-  {"pregnant_person_light_skin_tone", "\U0001FAC4\U0001F3FB", 14},
-  {"pregnant_person_medium_light_skin_tone", "\U0001FAC4\U0001F3FC", 14},
-  {"pregnant_person_medium_skin_tone", "\U0001FAC4\U0001F3FD", 14},
-  {"pregnant_person_medium_dark_skin_tone", "\U0001FAC4\U0001F3FE", 14},
-  {"pregnant_person_dark_skin_tone", "\U0001FAC4\U0001F3FF", 14},
-  {"breast_feeding", "\U0001F931", 5},
-  {"breast_feeding_light_skin_tone", "\U0001F931\U0001F3FB", 5},
-  {"breast_feeding_medium_light_skin_tone", "\U0001F931\U0001F3FC", 5},
-  {"breast_feeding_medium_skin_tone", "\U0001F931\U0001F3FD", 5},
-  {"breast_feeding_medium_dark_skin_tone", "\U0001F931\U0001F3FE", 5},
-  {"breast_feeding_dark_skin_tone", "\U0001F931\U0001F3FF", 5},
-  {"woman_feeding_baby", "\U0001F469\U0000200D\U0001F37C", 13},
-  {"woman_feeding_baby_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F37C", 13},
-  {"woman_feeding_baby_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F37C", 13},
-  {"woman_feeding_baby_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F37C", 13},
-  {"woman_feeding_baby_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F37C", 13},
-  {"woman_feeding_baby_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F37C", 13},
-  {"man_feeding_baby", "\U0001F468\U0000200D\U0001F37C", 13},
-  {"man_feeding_baby_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F37C", 13},
-  {"man_feeding_baby_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F37C", 13},
-  {"man_feeding_baby_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F37C", 13},
-  {"man_feeding_baby_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F37C", 13},
-  {"man_feeding_baby_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F37C", 13},
-  {"person_feeding_baby", "\U0001F9D1\U0000200D\U0001F37C", 13},
-  {"person_feeding_baby_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F37C", 13},
-  {"person_feeding_baby_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F37C", 13},
-  {"person_feeding_baby_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F37C", 13},
-  {"person_feeding_baby_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F37C", 13},
-  {"person_feeding_baby_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F37C", 13},
-  {"baby_angel", "\U0001F47C", 0},
-  {"baby_angel_light_skin_tone", "\U0001F47C\U0001F3FB", 1},
-  {"baby_angel_medium_light_skin_tone", "\U0001F47C\U0001F3FC", 1},
-  {"baby_angel_medium_skin_tone", "\U0001F47C\U0001F3FD", 1},
-  {"baby_angel_medium_dark_skin_tone", "\U0001F47C\U0001F3FE", 1},
-  {"baby_angel_dark_skin_tone", "\U0001F47C\U0001F3FF", 1},
-  {"santa_claus", "\U0001F385", 0},
-  {"santa_claus_light_skin_tone", "\U0001F385\U0001F3FB", 1},
-  {"santa_claus_medium_light_skin_tone", "\U0001F385\U0001F3FC", 1},
-  {"santa_claus_medium_skin_tone", "\U0001F385\U0001F3FD", 1},
-  {"santa_claus_medium_dark_skin_tone", "\U0001F385\U0001F3FE", 1},
-  {"santa_claus_dark_skin_tone", "\U0001F385\U0001F3FF", 1},
-  {"mrs_claus", "\U0001F936", 3},
-  {"mrs_claus_light_skin_tone", "\U0001F936\U0001F3FB", 3},
-  {"mrs_claus_medium_light_skin_tone", "\U0001F936\U0001F3FC", 3},
-  {"mrs_claus_medium_skin_tone", "\U0001F936\U0001F3FD", 3},
-  {"mrs_claus_medium_dark_skin_tone", "\U0001F936\U0001F3FE", 3},
-  {"mrs_claus_dark_skin_tone", "\U0001F936\U0001F3FF", 3},
-  {"mx_claus", "\U0001F9D1\U0000200D\U0001F384", 13},
-  {"mx_claus_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F384", 13},
-  {"mx_claus_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F384", 13},
-  {"mx_claus_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F384", 13},
-  {"mx_claus_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F384", 13},
-  {"mx_claus_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F384", 13},
-  {"superhero", "\U0001F9B8", 11},
-  {"superhero_light_skin_tone", "\U0001F9B8\U0001F3FB", 11},
-  {"superhero_medium_light_skin_tone", "\U0001F9B8\U0001F3FC", 11},
-  {"superhero_medium_skin_tone", "\U0001F9B8\U0001F3FD", 11},
-  {"superhero_medium_dark_skin_tone", "\U0001F9B8\U0001F3FE", 11},
-  {"superhero_dark_skin_tone", "\U0001F9B8\U0001F3FF", 11},
-  {"man_superhero", "\U0001F9B8\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_superhero_light_skin_tone", "\U0001F9B8\U0001F3FB\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_superhero_medium_light_skin_tone", "\U0001F9B8\U0001F3FC\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_superhero_medium_skin_tone", "\U0001F9B8\U0001F3FD\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_superhero_medium_dark_skin_tone", "\U0001F9B8\U0001F3FE\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_superhero_dark_skin_tone", "\U0001F9B8\U0001F3FF\U0000200D\U00002642\U0000FE0F", 11},
-  {"woman_superhero", "\U0001F9B8\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_superhero_light_skin_tone", "\U0001F9B8\U0001F3FB\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_superhero_medium_light_skin_tone", "\U0001F9B8\U0001F3FC\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_superhero_medium_skin_tone", "\U0001F9B8\U0001F3FD\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_superhero_medium_dark_skin_tone", "\U0001F9B8\U0001F3FE\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_superhero_dark_skin_tone", "\U0001F9B8\U0001F3FF\U0000200D\U00002640\U0000FE0F", 11},
-  {"supervillain", "\U0001F9B9", 11},
-  {"supervillain_light_skin_tone", "\U0001F9B9\U0001F3FB", 11},
-  {"supervillain_medium_light_skin_tone", "\U0001F9B9\U0001F3FC", 11},
-  {"supervillain_medium_skin_tone", "\U0001F9B9\U0001F3FD", 11},
-  {"supervillain_medium_dark_skin_tone", "\U0001F9B9\U0001F3FE", 11},
-  {"supervillain_dark_skin_tone", "\U0001F9B9\U0001F3FF", 11},
-  {"man_supervillain", "\U0001F9B9\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_supervillain_light_skin_tone", "\U0001F9B9\U0001F3FB\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_supervillain_medium_light_skin_tone", "\U0001F9B9\U0001F3FC\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_supervillain_medium_skin_tone", "\U0001F9B9\U0001F3FD\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_supervillain_medium_dark_skin_tone", "\U0001F9B9\U0001F3FE\U0000200D\U00002642\U0000FE0F", 11},
-  {"man_supervillain_dark_skin_tone", "\U0001F9B9\U0001F3FF\U0000200D\U00002642\U0000FE0F", 11},
-  {"woman_supervillain", "\U0001F9B9\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_supervillain_light_skin_tone", "\U0001F9B9\U0001F3FB\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_supervillain_medium_light_skin_tone", "\U0001F9B9\U0001F3FC\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_supervillain_medium_skin_tone", "\U0001F9B9\U0001F3FD\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_supervillain_medium_dark_skin_tone", "\U0001F9B9\U0001F3FE\U0000200D\U00002640\U0000FE0F", 11},
-  {"woman_supervillain_dark_skin_tone", "\U0001F9B9\U0001F3FF\U0000200D\U00002640\U0000FE0F", 11},
-  {"mage", "\U0001F9D9", 5},
-  {"mage_light_skin_tone", "\U0001F9D9\U0001F3FB", 5},
-  {"mage_medium_light_skin_tone", "\U0001F9D9\U0001F3FC", 5},
-  {"mage_medium_skin_tone", "\U0001F9D9\U0001F3FD", 5},
-  {"mage_medium_dark_skin_tone", "\U0001F9D9\U0001F3FE", 5},
-  {"mage_dark_skin_tone", "\U0001F9D9\U0001F3FF", 5},
-  {"man_mage", "\U0001F9D9\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_mage_light_skin_tone", "\U0001F9D9\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_mage_medium_light_skin_tone", "\U0001F9D9\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_mage_medium_skin_tone", "\U0001F9D9\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_mage_medium_dark_skin_tone", "\U0001F9D9\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_mage_dark_skin_tone", "\U0001F9D9\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_mage", "\U0001F9D9\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_mage_light_skin_tone", "\U0001F9D9\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_mage_medium_light_skin_tone", "\U0001F9D9\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_mage_medium_skin_tone", "\U0001F9D9\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_mage_medium_dark_skin_tone", "\U0001F9D9\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_mage_dark_skin_tone", "\U0001F9D9\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"fairy", "\U0001F9DA", 5},
-  {"fairy_light_skin_tone", "\U0001F9DA\U0001F3FB", 5},
-  {"fairy_medium_light_skin_tone", "\U0001F9DA\U0001F3FC", 5},
-  {"fairy_medium_skin_tone", "\U0001F9DA\U0001F3FD", 5},
-  {"fairy_medium_dark_skin_tone", "\U0001F9DA\U0001F3FE", 5},
-  {"fairy_dark_skin_tone", "\U0001F9DA\U0001F3FF", 5},
-  {"man_fairy", "\U0001F9DA\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_fairy_light_skin_tone", "\U0001F9DA\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_fairy_medium_light_skin_tone", "\U0001F9DA\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_fairy_medium_skin_tone", "\U0001F9DA\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_fairy_medium_dark_skin_tone", "\U0001F9DA\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_fairy_dark_skin_tone", "\U0001F9DA\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_fairy", "\U0001F9DA\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_fairy_light_skin_tone", "\U0001F9DA\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_fairy_medium_light_skin_tone", "\U0001F9DA\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_fairy_medium_skin_tone", "\U0001F9DA\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_fairy_medium_dark_skin_tone", "\U0001F9DA\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_fairy_dark_skin_tone", "\U0001F9DA\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"vampire", "\U0001F9DB", 5},
-  {"vampire_light_skin_tone", "\U0001F9DB\U0001F3FB", 5},
-  {"vampire_medium_light_skin_tone", "\U0001F9DB\U0001F3FC", 5},
-  {"vampire_medium_skin_tone", "\U0001F9DB\U0001F3FD", 5},
-  {"vampire_medium_dark_skin_tone", "\U0001F9DB\U0001F3FE", 5},
-  {"vampire_dark_skin_tone", "\U0001F9DB\U0001F3FF", 5},
-  {"man_vampire", "\U0001F9DB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_vampire_light_skin_tone", "\U0001F9DB\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_vampire_medium_light_skin_tone", "\U0001F9DB\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_vampire_medium_skin_tone", "\U0001F9DB\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_vampire_medium_dark_skin_tone", "\U0001F9DB\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_vampire_dark_skin_tone", "\U0001F9DB\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_vampire", "\U0001F9DB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_vampire_light_skin_tone", "\U0001F9DB\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_vampire_medium_light_skin_tone", "\U0001F9DB\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_vampire_medium_skin_tone", "\U0001F9DB\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_vampire_medium_dark_skin_tone", "\U0001F9DB\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_vampire_dark_skin_tone", "\U0001F9DB\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"merperson", "\U0001F9DC", 5},
-  {"merperson_light_skin_tone", "\U0001F9DC\U0001F3FB", 5},
-  {"merperson_medium_light_skin_tone", "\U0001F9DC\U0001F3FC", 5},
-  {"merperson_medium_skin_tone", "\U0001F9DC\U0001F3FD", 5},
-  {"merperson_medium_dark_skin_tone", "\U0001F9DC\U0001F3FE", 5},
-  {"merperson_dark_skin_tone", "\U0001F9DC\U0001F3FF", 5},
-  {"merman", "\U0001F9DC\U0000200D\U00002642\U0000FE0F", 5},
-  {"merman_light_skin_tone", "\U0001F9DC\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"merman_medium_light_skin_tone", "\U0001F9DC\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"merman_medium_skin_tone", "\U0001F9DC\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"merman_medium_dark_skin_tone", "\U0001F9DC\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"merman_dark_skin_tone", "\U0001F9DC\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"mermaid", "\U0001F9DC\U0000200D\U00002640\U0000FE0F", 5},
-  {"mermaid_light_skin_tone", "\U0001F9DC\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"mermaid_medium_light_skin_tone", "\U0001F9DC\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"mermaid_medium_skin_tone", "\U0001F9DC\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"mermaid_medium_dark_skin_tone", "\U0001F9DC\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"mermaid_dark_skin_tone", "\U0001F9DC\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"elf", "\U0001F9DD", 5},
-  {"elf_light_skin_tone", "\U0001F9DD\U0001F3FB", 5},
-  {"elf_medium_light_skin_tone", "\U0001F9DD\U0001F3FC", 5},
-  {"elf_medium_skin_tone", "\U0001F9DD\U0001F3FD", 5},
-  {"elf_medium_dark_skin_tone", "\U0001F9DD\U0001F3FE", 5},
-  {"elf_dark_skin_tone", "\U0001F9DD\U0001F3FF", 5},
-  {"man_elf", "\U0001F9DD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_elf_light_skin_tone", "\U0001F9DD\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_elf_medium_light_skin_tone", "\U0001F9DD\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_elf_medium_skin_tone", "\U0001F9DD\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_elf_medium_dark_skin_tone", "\U0001F9DD\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_elf_dark_skin_tone", "\U0001F9DD\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_elf", "\U0001F9DD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_elf_light_skin_tone", "\U0001F9DD\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_elf_medium_light_skin_tone", "\U0001F9DD\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_elf_medium_skin_tone", "\U0001F9DD\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_elf_medium_dark_skin_tone", "\U0001F9DD\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_elf_dark_skin_tone", "\U0001F9DD\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"genie", "\U0001F9DE", 5},
-  {"man_genie", "\U0001F9DE\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_genie", "\U0001F9DE\U0000200D\U00002640\U0000FE0F", 5},
-  {"zombie", "\U0001F9DF", 5},
-  {"man_zombie", "\U0001F9DF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_zombie", "\U0001F9DF\U0000200D\U00002640\U0000FE0F", 5},
-  {"troll", "\U0001F9CC", 14},
-  {"person_getting_massage", "\U0001F486", 0},
-  {"person_getting_massage_light_skin_tone", "\U0001F486\U0001F3FB", 1},
-  {"person_getting_massage_medium_light_skin_tone", "\U0001F486\U0001F3FC", 1},
-  {"person_getting_massage_medium_skin_tone", "\U0001F486\U0001F3FD", 1},
-  {"person_getting_massage_medium_dark_skin_tone", "\U0001F486\U0001F3FE", 1},
-  {"person_getting_massage_dark_skin_tone", "\U0001F486\U0001F3FF", 1},
-  {"man_getting_massage", "\U0001F486\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_massage_light_skin_tone", "\U0001F486\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_massage_medium_light_skin_tone", "\U0001F486\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_massage_medium_skin_tone", "\U0001F486\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_massage_medium_dark_skin_tone", "\U0001F486\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_massage_dark_skin_tone", "\U0001F486\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_getting_massage", "\U0001F486\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_massage_light_skin_tone", "\U0001F486\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_massage_medium_light_skin_tone", "\U0001F486\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_massage_medium_skin_tone", "\U0001F486\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_massage_medium_dark_skin_tone", "\U0001F486\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_massage_dark_skin_tone", "\U0001F486\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_getting_haircut", "\U0001F487", 0},
-  {"person_getting_haircut_light_skin_tone", "\U0001F487\U0001F3FB", 1},
-  {"person_getting_haircut_medium_light_skin_tone", "\U0001F487\U0001F3FC", 1},
-  {"person_getting_haircut_medium_skin_tone", "\U0001F487\U0001F3FD", 1},
-  {"person_getting_haircut_medium_dark_skin_tone", "\U0001F487\U0001F3FE", 1},
-  {"person_getting_haircut_dark_skin_tone", "\U0001F487\U0001F3FF", 1},
-  {"man_getting_haircut", "\U0001F487\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_haircut_light_skin_tone", "\U0001F487\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_haircut_medium_light_skin_tone", "\U0001F487\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_haircut_medium_skin_tone", "\U0001F487\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_haircut_medium_dark_skin_tone", "\U0001F487\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_getting_haircut_dark_skin_tone", "\U0001F487\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_getting_haircut", "\U0001F487\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_haircut_light_skin_tone", "\U0001F487\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_haircut_medium_light_skin_tone", "\U0001F487\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_haircut_medium_skin_tone", "\U0001F487\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_haircut_medium_dark_skin_tone", "\U0001F487\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_getting_haircut_dark_skin_tone", "\U0001F487\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_walking", "\U0001F6B6", 0},
-  {"person_walking_light_skin_tone", "\U0001F6B6\U0001F3FB", 1},
-  {"person_walking_medium_light_skin_tone", "\U0001F6B6\U0001F3FC", 1},
-  {"person_walking_medium_skin_tone", "\U0001F6B6\U0001F3FD", 1},
-  {"person_walking_medium_dark_skin_tone", "\U0001F6B6\U0001F3FE", 1},
-  {"person_walking_dark_skin_tone", "\U0001F6B6\U0001F3FF", 1},
-  {"man_walking", "\U0001F6B6\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_walking_light_skin_tone", "\U0001F6B6\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_walking_medium_light_skin_tone", "\U0001F6B6\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_walking_medium_skin_tone", "\U0001F6B6\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_walking_medium_dark_skin_tone", "\U0001F6B6\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_walking_dark_skin_tone", "\U0001F6B6\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_walking", "\U0001F6B6\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_walking_light_skin_tone", "\U0001F6B6\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_walking_medium_light_skin_tone", "\U0001F6B6\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_walking_medium_skin_tone", "\U0001F6B6\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_walking_medium_dark_skin_tone", "\U0001F6B6\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_walking_dark_skin_tone", "\U0001F6B6\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_standing", "\U0001F9CD", 12},
-  {"person_standing_light_skin_tone", "\U0001F9CD\U0001F3FB", 12},
-  {"person_standing_medium_light_skin_tone", "\U0001F9CD\U0001F3FC", 12},
-  {"person_standing_medium_skin_tone", "\U0001F9CD\U0001F3FD", 12},
-  {"person_standing_medium_dark_skin_tone", "\U0001F9CD\U0001F3FE", 12},
-  {"person_standing_dark_skin_tone", "\U0001F9CD\U0001F3FF", 12},
-  {"man_standing", "\U0001F9CD\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_standing_light_skin_tone", "\U0001F9CD\U0001F3FB\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_standing_medium_light_skin_tone", "\U0001F9CD\U0001F3FC\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_standing_medium_skin_tone", "\U0001F9CD\U0001F3FD\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_standing_medium_dark_skin_tone", "\U0001F9CD\U0001F3FE\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_standing_dark_skin_tone", "\U0001F9CD\U0001F3FF\U0000200D\U00002642\U0000FE0F", 12},
-  {"woman_standing", "\U0001F9CD\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_standing_light_skin_tone", "\U0001F9CD\U0001F3FB\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_standing_medium_light_skin_tone", "\U0001F9CD\U0001F3FC\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_standing_medium_skin_tone", "\U0001F9CD\U0001F3FD\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_standing_medium_dark_skin_tone", "\U0001F9CD\U0001F3FE\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_standing_dark_skin_tone", "\U0001F9CD\U0001F3FF\U0000200D\U00002640\U0000FE0F", 12},
-  {"person_kneeling", "\U0001F9CE", 12},
-  {"person_kneeling_light_skin_tone", "\U0001F9CE\U0001F3FB", 12},
-  {"person_kneeling_medium_light_skin_tone", "\U0001F9CE\U0001F3FC", 12},
-  {"person_kneeling_medium_skin_tone", "\U0001F9CE\U0001F3FD", 12},
-  {"person_kneeling_medium_dark_skin_tone", "\U0001F9CE\U0001F3FE", 12},
-  {"person_kneeling_dark_skin_tone", "\U0001F9CE\U0001F3FF", 12},
-  {"man_kneeling", "\U0001F9CE\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_kneeling_light_skin_tone", "\U0001F9CE\U0001F3FB\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_kneeling_medium_light_skin_tone", "\U0001F9CE\U0001F3FC\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_kneeling_medium_skin_tone", "\U0001F9CE\U0001F3FD\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_kneeling_medium_dark_skin_tone", "\U0001F9CE\U0001F3FE\U0000200D\U00002642\U0000FE0F", 12},
-  {"man_kneeling_dark_skin_tone", "\U0001F9CE\U0001F3FF\U0000200D\U00002642\U0000FE0F", 12},
-  {"woman_kneeling", "\U0001F9CE\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_kneeling_light_skin_tone", "\U0001F9CE\U0001F3FB\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_kneeling_medium_light_skin_tone", "\U0001F9CE\U0001F3FC\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_kneeling_medium_skin_tone", "\U0001F9CE\U0001F3FD\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_kneeling_medium_dark_skin_tone", "\U0001F9CE\U0001F3FE\U0000200D\U00002640\U0000FE0F", 12},
-  {"woman_kneeling_dark_skin_tone", "\U0001F9CE\U0001F3FF\U0000200D\U00002640\U0000FE0F", 12},
-  {"person_with_white_cane", "\U0001F9D1\U0000200D\U0001F9AF", 12},
-  {"person_with_white_cane_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F9AF", 12},
-  {"person_with_white_cane_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F9AF", 12},
-  {"person_with_white_cane_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F9AF", 12},
-  {"person_with_white_cane_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F9AF", 12},
-  {"person_with_white_cane_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F9AF", 12},
-  {"man_with_white_cane", "\U0001F468\U0000200D\U0001F9AF", 12},
-  {"man_with_white_cane_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F9AF", 12},
-  {"man_with_white_cane_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F9AF", 12},
-  {"man_with_white_cane_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F9AF", 12},
-  {"man_with_white_cane_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F9AF", 12},
-  {"man_with_white_cane_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F9AF", 12},
-  {"woman_with_white_cane", "\U0001F469\U0000200D\U0001F9AF", 12},
-  {"woman_with_white_cane_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F9AF", 12},
-  {"woman_with_white_cane_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F9AF", 12},
-  {"woman_with_white_cane_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F9AF", 12},
-  {"woman_with_white_cane_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F9AF", 12},
-  {"woman_with_white_cane_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F9AF", 12},
-  {"person_in_motorized_wheelchair", "\U0001F9D1\U0000200D\U0001F9BC", 12},
-  {"person_in_motorized_wheelchair_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F9BC", 12},
-  {"person_in_motorized_wheelchair_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F9BC", 12},
-  {"person_in_motorized_wheelchair_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F9BC", 12},
-  {"person_in_motorized_wheelchair_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F9BC", 12},
-  {"person_in_motorized_wheelchair_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F9BC", 12},
-  {"man_in_motorized_wheelchair", "\U0001F468\U0000200D\U0001F9BC", 12},
-  {"man_in_motorized_wheelchair_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F9BC", 12},
-  {"man_in_motorized_wheelchair_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F9BC", 12},
-  {"man_in_motorized_wheelchair_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F9BC", 12},
-  {"man_in_motorized_wheelchair_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F9BC", 12},
-  {"man_in_motorized_wheelchair_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F9BC", 12},
-  {"woman_in_motorized_wheelchair", "\U0001F469\U0000200D\U0001F9BC", 12},
-  {"woman_in_motorized_wheelchair_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F9BC", 12},
-  {"woman_in_motorized_wheelchair_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F9BC", 12},
-  {"woman_in_motorized_wheelchair_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F9BC", 12},
-  {"woman_in_motorized_wheelchair_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F9BC", 12},
-  {"woman_in_motorized_wheelchair_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F9BC", 12},
-  {"person_in_manual_wheelchair", "\U0001F9D1\U0000200D\U0001F9BD", 12},
-  {"person_in_manual_wheelchair_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F9BD", 12},
-  {"person_in_manual_wheelchair_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F9BD", 12},
-  {"person_in_manual_wheelchair_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F9BD", 12},
-  {"person_in_manual_wheelchair_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F9BD", 12},
-  {"person_in_manual_wheelchair_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F9BD", 12},
-  {"man_in_manual_wheelchair", "\U0001F468\U0000200D\U0001F9BD", 12},
-  {"man_in_manual_wheelchair_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F9BD", 12},
-  {"man_in_manual_wheelchair_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F9BD", 12},
-  {"man_in_manual_wheelchair_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F9BD", 12},
-  {"man_in_manual_wheelchair_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F9BD", 12},
-  {"man_in_manual_wheelchair_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F9BD", 12},
-  {"woman_in_manual_wheelchair", "\U0001F469\U0000200D\U0001F9BD", 12},
-  {"woman_in_manual_wheelchair_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F9BD", 12},
-  {"woman_in_manual_wheelchair_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F9BD", 12},
-  {"woman_in_manual_wheelchair_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F9BD", 12},
-  {"woman_in_manual_wheelchair_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F9BD", 12},
-  {"woman_in_manual_wheelchair_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F9BD", 12},
-  {"person_running", "\U0001F3C3", 0},
-  {"person_running_light_skin_tone", "\U0001F3C3\U0001F3FB", 1},
-  {"person_running_medium_light_skin_tone", "\U0001F3C3\U0001F3FC", 1},
-  {"person_running_medium_skin_tone", "\U0001F3C3\U0001F3FD", 1},
-  {"person_running_medium_dark_skin_tone", "\U0001F3C3\U0001F3FE", 1},
-  {"person_running_dark_skin_tone", "\U0001F3C3\U0001F3FF", 1},
-  {"man_running", "\U0001F3C3\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_running_light_skin_tone", "\U0001F3C3\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_running_medium_light_skin_tone", "\U0001F3C3\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_running_medium_skin_tone", "\U0001F3C3\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_running_medium_dark_skin_tone", "\U0001F3C3\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_running_dark_skin_tone", "\U0001F3C3\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_running", "\U0001F3C3\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_running_light_skin_tone", "\U0001F3C3\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_running_medium_light_skin_tone", "\U0001F3C3\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_running_medium_skin_tone", "\U0001F3C3\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_running_medium_dark_skin_tone", "\U0001F3C3\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_running_dark_skin_tone", "\U0001F3C3\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_dancing", "\U0001F483", 0},
-  {"woman_dancing_light_skin_tone", "\U0001F483\U0001F3FB", 1},
-  {"woman_dancing_medium_light_skin_tone", "\U0001F483\U0001F3FC", 1},
-  {"woman_dancing_medium_skin_tone", "\U0001F483\U0001F3FD", 1},
-  {"woman_dancing_medium_dark_skin_tone", "\U0001F483\U0001F3FE", 1},
-  {"woman_dancing_dark_skin_tone", "\U0001F483\U0001F3FF", 1},
-  {"man_dancing", "\U0001F57A", 3},
-  {"man_dancing_light_skin_tone", "\U0001F57A\U0001F3FB", 3},
-  {"man_dancing_medium_light_skin_tone", "\U0001F57A\U0001F3FC", 3},
-  {"man_dancing_medium_skin_tone", "\U0001F57A\U0001F3FD", 3},
-  {"man_dancing_medium_dark_skin_tone", "\U0001F57A\U0001F3FE", 3},
-  {"man_dancing_dark_skin_tone", "\U0001F57A\U0001F3FF", 3},
-  {"person_in_suit_levitating", "\U0001F574", 0},
-  {"person_in_suit_levitating_light_skin_tone", "\U0001F574\U0001F3FB", 4},
-  {"person_in_suit_levitating_medium_light_skin_tone", "\U0001F574\U0001F3FC", 4},
-  {"person_in_suit_levitating_medium_skin_tone", "\U0001F574\U0001F3FD", 4},
-  {"person_in_suit_levitating_medium_dark_skin_tone", "\U0001F574\U0001F3FE", 4},
-  {"person_in_suit_levitating_dark_skin_tone", "\U0001F574\U0001F3FF", 4},
-  {"people_with_bunny_ears", "\U0001F46F", 0},
-  {"men_with_bunny_ears", "\U0001F46F\U0000200D\U00002642\U0000FE0F", 4},
-  {"women_with_bunny_ears", "\U0001F46F\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_in_steamy_room", "\U0001F9D6", 5},
-  {"person_in_steamy_room_light_skin_tone", "\U0001F9D6\U0001F3FB", 5},
-  {"person_in_steamy_room_medium_light_skin_tone", "\U0001F9D6\U0001F3FC", 5},
-  {"person_in_steamy_room_medium_skin_tone", "\U0001F9D6\U0001F3FD", 5},
-  {"person_in_steamy_room_medium_dark_skin_tone", "\U0001F9D6\U0001F3FE", 5},
-  {"person_in_steamy_room_dark_skin_tone", "\U0001F9D6\U0001F3FF", 5},
-  {"man_in_steamy_room", "\U0001F9D6\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_steamy_room_light_skin_tone", "\U0001F9D6\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_steamy_room_medium_light_skin_tone", "\U0001F9D6\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_steamy_room_medium_skin_tone", "\U0001F9D6\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_steamy_room_medium_dark_skin_tone", "\U0001F9D6\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_steamy_room_dark_skin_tone", "\U0001F9D6\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_in_steamy_room", "\U0001F9D6\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_steamy_room_light_skin_tone", "\U0001F9D6\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_steamy_room_medium_light_skin_tone", "\U0001F9D6\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_steamy_room_medium_skin_tone", "\U0001F9D6\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_steamy_room_medium_dark_skin_tone", "\U0001F9D6\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_steamy_room_dark_skin_tone", "\U0001F9D6\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"person_climbing", "\U0001F9D7", 5},
-  {"person_climbing_light_skin_tone", "\U0001F9D7\U0001F3FB", 5},
-  {"person_climbing_medium_light_skin_tone", "\U0001F9D7\U0001F3FC", 5},
-  {"person_climbing_medium_skin_tone", "\U0001F9D7\U0001F3FD", 5},
-  {"person_climbing_medium_dark_skin_tone", "\U0001F9D7\U0001F3FE", 5},
-  {"person_climbing_dark_skin_tone", "\U0001F9D7\U0001F3FF", 5},
-  {"man_climbing", "\U0001F9D7\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_climbing_light_skin_tone", "\U0001F9D7\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_climbing_medium_light_skin_tone", "\U0001F9D7\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_climbing_medium_skin_tone", "\U0001F9D7\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_climbing_medium_dark_skin_tone", "\U0001F9D7\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_climbing_dark_skin_tone", "\U0001F9D7\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_climbing", "\U0001F9D7\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_climbing_light_skin_tone", "\U0001F9D7\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_climbing_medium_light_skin_tone", "\U0001F9D7\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_climbing_medium_skin_tone", "\U0001F9D7\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_climbing_medium_dark_skin_tone", "\U0001F9D7\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_climbing_dark_skin_tone", "\U0001F9D7\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"person_fencing", "\U0001F93A", 3},
-  {"horse_racing", "\U0001F3C7", 1},
-  {"horse_racing_light_skin_tone", "\U0001F3C7\U0001F3FB", 1},
-  {"horse_racing_medium_light_skin_tone", "\U0001F3C7\U0001F3FC", 1},
-  {"horse_racing_medium_skin_tone", "\U0001F3C7\U0001F3FD", 1},
-  {"horse_racing_medium_dark_skin_tone", "\U0001F3C7\U0001F3FE", 1},
-  {"horse_racing_dark_skin_tone", "\U0001F3C7\U0001F3FF", 1},
-  {"skier", "\U000026F7", 0},
-  {"snowboarder", "\U0001F3C2", 0},
-  {"snowboarder_light_skin_tone", "\U0001F3C2\U0001F3FB", 1},
-  {"snowboarder_medium_light_skin_tone", "\U0001F3C2\U0001F3FC", 1},
-  {"snowboarder_medium_skin_tone", "\U0001F3C2\U0001F3FD", 1},
-  {"snowboarder_medium_dark_skin_tone", "\U0001F3C2\U0001F3FE", 1},
-  {"snowboarder_dark_skin_tone", "\U0001F3C2\U0001F3FF", 1},
-  {"person_golfing", "\U0001F3CC", 0},
-  {"person_golfing_light_skin_tone", "\U0001F3CC\U0001F3FB", 4},
-  {"person_golfing_medium_light_skin_tone", "\U0001F3CC\U0001F3FC", 4},
-  {"person_golfing_medium_skin_tone", "\U0001F3CC\U0001F3FD", 4},
-  {"person_golfing_medium_dark_skin_tone", "\U0001F3CC\U0001F3FE", 4},
-  {"person_golfing_dark_skin_tone", "\U0001F3CC\U0001F3FF", 4},
-  {"man_golfing", "\U0001F3CC\U0000FE0F\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_golfing_light_skin_tone", "\U0001F3CC\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_golfing_medium_light_skin_tone", "\U0001F3CC\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_golfing_medium_skin_tone", "\U0001F3CC\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_golfing_medium_dark_skin_tone", "\U0001F3CC\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_golfing_dark_skin_tone", "\U0001F3CC\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_golfing", "\U0001F3CC\U0000FE0F\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_golfing_light_skin_tone", "\U0001F3CC\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_golfing_medium_light_skin_tone", "\U0001F3CC\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_golfing_medium_skin_tone", "\U0001F3CC\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_golfing_medium_dark_skin_tone", "\U0001F3CC\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_golfing_dark_skin_tone", "\U0001F3CC\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_surfing", "\U0001F3C4", 0},
-  {"person_surfing_light_skin_tone", "\U0001F3C4\U0001F3FB", 1},
-  {"person_surfing_medium_light_skin_tone", "\U0001F3C4\U0001F3FC", 1},
-  {"person_surfing_medium_skin_tone", "\U0001F3C4\U0001F3FD", 1},
-  {"person_surfing_medium_dark_skin_tone", "\U0001F3C4\U0001F3FE", 1},
-  {"person_surfing_dark_skin_tone", "\U0001F3C4\U0001F3FF", 1},
-  {"man_surfing", "\U0001F3C4\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_surfing_light_skin_tone", "\U0001F3C4\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_surfing_medium_light_skin_tone", "\U0001F3C4\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_surfing_medium_skin_tone", "\U0001F3C4\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_surfing_medium_dark_skin_tone", "\U0001F3C4\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_surfing_dark_skin_tone", "\U0001F3C4\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_surfing", "\U0001F3C4\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_surfing_light_skin_tone", "\U0001F3C4\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_surfing_medium_light_skin_tone", "\U0001F3C4\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_surfing_medium_skin_tone", "\U0001F3C4\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_surfing_medium_dark_skin_tone", "\U0001F3C4\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_surfing_dark_skin_tone", "\U0001F3C4\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_rowing_boat", "\U0001F6A3", 1},
-  {"person_rowing_boat_light_skin_tone", "\U0001F6A3\U0001F3FB", 1},
-  {"person_rowing_boat_medium_light_skin_tone", "\U0001F6A3\U0001F3FC", 1},
-  {"person_rowing_boat_medium_skin_tone", "\U0001F6A3\U0001F3FD", 1},
-  {"person_rowing_boat_medium_dark_skin_tone", "\U0001F6A3\U0001F3FE", 1},
-  {"person_rowing_boat_dark_skin_tone", "\U0001F6A3\U0001F3FF", 1},
-  {"man_rowing_boat", "\U0001F6A3\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_rowing_boat_light_skin_tone", "\U0001F6A3\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_rowing_boat_medium_light_skin_tone", "\U0001F6A3\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_rowing_boat_medium_skin_tone", "\U0001F6A3\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_rowing_boat_medium_dark_skin_tone", "\U0001F6A3\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_rowing_boat_dark_skin_tone", "\U0001F6A3\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_rowing_boat", "\U0001F6A3\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_rowing_boat_light_skin_tone", "\U0001F6A3\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_rowing_boat_medium_light_skin_tone", "\U0001F6A3\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_rowing_boat_medium_skin_tone", "\U0001F6A3\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_rowing_boat_medium_dark_skin_tone", "\U0001F6A3\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_rowing_boat_dark_skin_tone", "\U0001F6A3\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_swimming", "\U0001F3CA", 0},
-  {"person_swimming_light_skin_tone", "\U0001F3CA\U0001F3FB", 1},
-  {"person_swimming_medium_light_skin_tone", "\U0001F3CA\U0001F3FC", 1},
-  {"person_swimming_medium_skin_tone", "\U0001F3CA\U0001F3FD", 1},
-  {"person_swimming_medium_dark_skin_tone", "\U0001F3CA\U0001F3FE", 1},
-  {"person_swimming_dark_skin_tone", "\U0001F3CA\U0001F3FF", 1},
-  {"man_swimming", "\U0001F3CA\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_swimming_light_skin_tone", "\U0001F3CA\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_swimming_medium_light_skin_tone", "\U0001F3CA\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_swimming_medium_skin_tone", "\U0001F3CA\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_swimming_medium_dark_skin_tone", "\U0001F3CA\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_swimming_dark_skin_tone", "\U0001F3CA\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_swimming", "\U0001F3CA\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_swimming_light_skin_tone", "\U0001F3CA\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_swimming_medium_light_skin_tone", "\U0001F3CA\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_swimming_medium_skin_tone", "\U0001F3CA\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_swimming_medium_dark_skin_tone", "\U0001F3CA\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_swimming_dark_skin_tone", "\U0001F3CA\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_bouncing_ball", "\U000026F9", 0},
-  {"person_bouncing_ball_light_skin_tone", "\U000026F9\U0001F3FB", 2},
-  {"person_bouncing_ball_medium_light_skin_tone", "\U000026F9\U0001F3FC", 2},
-  {"person_bouncing_ball_medium_skin_tone", "\U000026F9\U0001F3FD", 2},
-  {"person_bouncing_ball_medium_dark_skin_tone", "\U000026F9\U0001F3FE", 2},
-  {"person_bouncing_ball_dark_skin_tone", "\U000026F9\U0001F3FF", 2},
-  {"man_bouncing_ball", "\U000026F9\U0000FE0F\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bouncing_ball_light_skin_tone", "\U000026F9\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bouncing_ball_medium_light_skin_tone", "\U000026F9\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bouncing_ball_medium_skin_tone", "\U000026F9\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bouncing_ball_medium_dark_skin_tone", "\U000026F9\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_bouncing_ball_dark_skin_tone", "\U000026F9\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_bouncing_ball", "\U000026F9\U0000FE0F\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bouncing_ball_light_skin_tone", "\U000026F9\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bouncing_ball_medium_light_skin_tone", "\U000026F9\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bouncing_ball_medium_skin_tone", "\U000026F9\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bouncing_ball_medium_dark_skin_tone", "\U000026F9\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_bouncing_ball_dark_skin_tone", "\U000026F9\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_lifting_weights", "\U0001F3CB", 0},
-  {"person_lifting_weights_light_skin_tone", "\U0001F3CB\U0001F3FB", 2},
-  {"person_lifting_weights_medium_light_skin_tone", "\U0001F3CB\U0001F3FC", 2},
-  {"person_lifting_weights_medium_skin_tone", "\U0001F3CB\U0001F3FD", 2},
-  {"person_lifting_weights_medium_dark_skin_tone", "\U0001F3CB\U0001F3FE", 2},
-  {"person_lifting_weights_dark_skin_tone", "\U0001F3CB\U0001F3FF", 2},
-  {"man_lifting_weights", "\U0001F3CB\U0000FE0F\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_lifting_weights_light_skin_tone", "\U0001F3CB\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_lifting_weights_medium_light_skin_tone", "\U0001F3CB\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_lifting_weights_medium_skin_tone", "\U0001F3CB\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_lifting_weights_medium_dark_skin_tone", "\U0001F3CB\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_lifting_weights_dark_skin_tone", "\U0001F3CB\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_lifting_weights", "\U0001F3CB\U0000FE0F\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_lifting_weights_light_skin_tone", "\U0001F3CB\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_lifting_weights_medium_light_skin_tone", "\U0001F3CB\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_lifting_weights_medium_skin_tone", "\U0001F3CB\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_lifting_weights_medium_dark_skin_tone", "\U0001F3CB\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_lifting_weights_dark_skin_tone", "\U0001F3CB\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_biking", "\U0001F6B4", 1},
-  {"person_biking_light_skin_tone", "\U0001F6B4\U0001F3FB", 1},
-  {"person_biking_medium_light_skin_tone", "\U0001F6B4\U0001F3FC", 1},
-  {"person_biking_medium_skin_tone", "\U0001F6B4\U0001F3FD", 1},
-  {"person_biking_medium_dark_skin_tone", "\U0001F6B4\U0001F3FE", 1},
-  {"person_biking_dark_skin_tone", "\U0001F6B4\U0001F3FF", 1},
-  {"man_biking", "\U0001F6B4\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_biking_light_skin_tone", "\U0001F6B4\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_biking_medium_light_skin_tone", "\U0001F6B4\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_biking_medium_skin_tone", "\U0001F6B4\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_biking_medium_dark_skin_tone", "\U0001F6B4\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_biking_dark_skin_tone", "\U0001F6B4\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_biking", "\U0001F6B4\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_biking_light_skin_tone", "\U0001F6B4\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_biking_medium_light_skin_tone", "\U0001F6B4\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_biking_medium_skin_tone", "\U0001F6B4\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_biking_medium_dark_skin_tone", "\U0001F6B4\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_biking_dark_skin_tone", "\U0001F6B4\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_mountain_biking", "\U0001F6B5", 1},
-  {"person_mountain_biking_light_skin_tone", "\U0001F6B5\U0001F3FB", 1},
-  {"person_mountain_biking_medium_light_skin_tone", "\U0001F6B5\U0001F3FC", 1},
-  {"person_mountain_biking_medium_skin_tone", "\U0001F6B5\U0001F3FD", 1},
-  {"person_mountain_biking_medium_dark_skin_tone", "\U0001F6B5\U0001F3FE", 1},
-  {"person_mountain_biking_dark_skin_tone", "\U0001F6B5\U0001F3FF", 1},
-  {"man_mountain_biking", "\U0001F6B5\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_mountain_biking_light_skin_tone", "\U0001F6B5\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_mountain_biking_medium_light_skin_tone", "\U0001F6B5\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_mountain_biking_medium_skin_tone", "\U0001F6B5\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_mountain_biking_medium_dark_skin_tone", "\U0001F6B5\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_mountain_biking_dark_skin_tone", "\U0001F6B5\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_mountain_biking", "\U0001F6B5\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_mountain_biking_light_skin_tone", "\U0001F6B5\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_mountain_biking_medium_light_skin_tone", "\U0001F6B5\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_mountain_biking_medium_skin_tone", "\U0001F6B5\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_mountain_biking_medium_dark_skin_tone", "\U0001F6B5\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_mountain_biking_dark_skin_tone", "\U0001F6B5\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_cartwheeling", "\U0001F938", 3},
-  {"person_cartwheeling_light_skin_tone", "\U0001F938\U0001F3FB", 3},
-  {"person_cartwheeling_medium_light_skin_tone", "\U0001F938\U0001F3FC", 3},
-  {"person_cartwheeling_medium_skin_tone", "\U0001F938\U0001F3FD", 3},
-  {"person_cartwheeling_medium_dark_skin_tone", "\U0001F938\U0001F3FE", 3},
-  {"person_cartwheeling_dark_skin_tone", "\U0001F938\U0001F3FF", 3},
-  {"man_cartwheeling", "\U0001F938\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_cartwheeling_light_skin_tone", "\U0001F938\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_cartwheeling_medium_light_skin_tone", "\U0001F938\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_cartwheeling_medium_skin_tone", "\U0001F938\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_cartwheeling_medium_dark_skin_tone", "\U0001F938\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_cartwheeling_dark_skin_tone", "\U0001F938\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_cartwheeling", "\U0001F938\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_cartwheeling_light_skin_tone", "\U0001F938\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_cartwheeling_medium_light_skin_tone", "\U0001F938\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_cartwheeling_medium_skin_tone", "\U0001F938\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_cartwheeling_medium_dark_skin_tone", "\U0001F938\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_cartwheeling_dark_skin_tone", "\U0001F938\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"people_wrestling", "\U0001F93C", 3},
-  {"men_wrestling", "\U0001F93C\U0000200D\U00002642\U0000FE0F", 4},
-  {"women_wrestling", "\U0001F93C\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_playing_water_polo", "\U0001F93D", 3},
-  {"person_playing_water_polo_light_skin_tone", "\U0001F93D\U0001F3FB", 3},
-  {"person_playing_water_polo_medium_light_skin_tone", "\U0001F93D\U0001F3FC", 3},
-  {"person_playing_water_polo_medium_skin_tone", "\U0001F93D\U0001F3FD", 3},
-  {"person_playing_water_polo_medium_dark_skin_tone", "\U0001F93D\U0001F3FE", 3},
-  {"person_playing_water_polo_dark_skin_tone", "\U0001F93D\U0001F3FF", 3},
-  {"man_playing_water_polo", "\U0001F93D\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_water_polo_light_skin_tone", "\U0001F93D\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_water_polo_medium_light_skin_tone", "\U0001F93D\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_water_polo_medium_skin_tone", "\U0001F93D\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_water_polo_medium_dark_skin_tone", "\U0001F93D\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_water_polo_dark_skin_tone", "\U0001F93D\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_playing_water_polo", "\U0001F93D\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_water_polo_light_skin_tone", "\U0001F93D\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_water_polo_medium_light_skin_tone", "\U0001F93D\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_water_polo_medium_skin_tone", "\U0001F93D\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_water_polo_medium_dark_skin_tone", "\U0001F93D\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_water_polo_dark_skin_tone", "\U0001F93D\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_playing_handball", "\U0001F93E", 3},
-  {"person_playing_handball_light_skin_tone", "\U0001F93E\U0001F3FB", 3},
-  {"person_playing_handball_medium_light_skin_tone", "\U0001F93E\U0001F3FC", 3},
-  {"person_playing_handball_medium_skin_tone", "\U0001F93E\U0001F3FD", 3},
-  {"person_playing_handball_medium_dark_skin_tone", "\U0001F93E\U0001F3FE", 3},
-  {"person_playing_handball_dark_skin_tone", "\U0001F93E\U0001F3FF", 3},
-  {"man_playing_handball", "\U0001F93E\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_handball_light_skin_tone", "\U0001F93E\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_handball_medium_light_skin_tone", "\U0001F93E\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_handball_medium_skin_tone", "\U0001F93E\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_handball_medium_dark_skin_tone", "\U0001F93E\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_playing_handball_dark_skin_tone", "\U0001F93E\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_playing_handball", "\U0001F93E\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_handball_light_skin_tone", "\U0001F93E\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_handball_medium_light_skin_tone", "\U0001F93E\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_handball_medium_skin_tone", "\U0001F93E\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_handball_medium_dark_skin_tone", "\U0001F93E\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_playing_handball_dark_skin_tone", "\U0001F93E\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_juggling", "\U0001F939", 3},
-  {"person_juggling_light_skin_tone", "\U0001F939\U0001F3FB", 3},
-  {"person_juggling_medium_light_skin_tone", "\U0001F939\U0001F3FC", 3},
-  {"person_juggling_medium_skin_tone", "\U0001F939\U0001F3FD", 3},
-  {"person_juggling_medium_dark_skin_tone", "\U0001F939\U0001F3FE", 3},
-  {"person_juggling_dark_skin_tone", "\U0001F939\U0001F3FF", 3},
-  {"man_juggling", "\U0001F939\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_juggling_light_skin_tone", "\U0001F939\U0001F3FB\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_juggling_medium_light_skin_tone", "\U0001F939\U0001F3FC\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_juggling_medium_skin_tone", "\U0001F939\U0001F3FD\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_juggling_medium_dark_skin_tone", "\U0001F939\U0001F3FE\U0000200D\U00002642\U0000FE0F", 4},
-  {"man_juggling_dark_skin_tone", "\U0001F939\U0001F3FF\U0000200D\U00002642\U0000FE0F", 4},
-  {"woman_juggling", "\U0001F939\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_juggling_light_skin_tone", "\U0001F939\U0001F3FB\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_juggling_medium_light_skin_tone", "\U0001F939\U0001F3FC\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_juggling_medium_skin_tone", "\U0001F939\U0001F3FD\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_juggling_medium_dark_skin_tone", "\U0001F939\U0001F3FE\U0000200D\U00002640\U0000FE0F", 4},
-  {"woman_juggling_dark_skin_tone", "\U0001F939\U0001F3FF\U0000200D\U00002640\U0000FE0F", 4},
-  {"person_in_lotus_position", "\U0001F9D8", 5},
-  {"person_in_lotus_position_light_skin_tone", "\U0001F9D8\U0001F3FB", 5},
-  {"person_in_lotus_position_medium_light_skin_tone", "\U0001F9D8\U0001F3FC", 5},
-  {"person_in_lotus_position_medium_skin_tone", "\U0001F9D8\U0001F3FD", 5},
-  {"person_in_lotus_position_medium_dark_skin_tone", "\U0001F9D8\U0001F3FE", 5},
-  {"person_in_lotus_position_dark_skin_tone", "\U0001F9D8\U0001F3FF", 5},
-  {"man_in_lotus_position", "\U0001F9D8\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_lotus_position_light_skin_tone", "\U0001F9D8\U0001F3FB\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_lotus_position_medium_light_skin_tone", "\U0001F9D8\U0001F3FC\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_lotus_position_medium_skin_tone", "\U0001F9D8\U0001F3FD\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_lotus_position_medium_dark_skin_tone", "\U0001F9D8\U0001F3FE\U0000200D\U00002642\U0000FE0F", 5},
-  {"man_in_lotus_position_dark_skin_tone", "\U0001F9D8\U0001F3FF\U0000200D\U00002642\U0000FE0F", 5},
-  {"woman_in_lotus_position", "\U0001F9D8\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_lotus_position_light_skin_tone", "\U0001F9D8\U0001F3FB\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_lotus_position_medium_light_skin_tone", "\U0001F9D8\U0001F3FC\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_lotus_position_medium_skin_tone", "\U0001F9D8\U0001F3FD\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_lotus_position_medium_dark_skin_tone", "\U0001F9D8\U0001F3FE\U0000200D\U00002640\U0000FE0F", 5},
-  {"woman_in_lotus_position_dark_skin_tone", "\U0001F9D8\U0001F3FF\U0000200D\U00002640\U0000FE0F", 5},
-  {"person_taking_bath", "\U0001F6C0", 0},
-  {"person_taking_bath_light_skin_tone", "\U0001F6C0\U0001F3FB", 1},
-  {"person_taking_bath_medium_light_skin_tone", "\U0001F6C0\U0001F3FC", 1},
-  {"person_taking_bath_medium_skin_tone", "\U0001F6C0\U0001F3FD", 1},
-  {"person_taking_bath_medium_dark_skin_tone", "\U0001F6C0\U0001F3FE", 1},
-  {"person_taking_bath_dark_skin_tone", "\U0001F6C0\U0001F3FF", 1},
-  {"person_in_bed", "\U0001F6CC", 1},
-  {"person_in_bed_light_skin_tone", "\U0001F6CC\U0001F3FB", 4},
-  {"person_in_bed_medium_light_skin_tone", "\U0001F6CC\U0001F3FC", 4},
-  {"person_in_bed_medium_skin_tone", "\U0001F6CC\U0001F3FD", 4},
-  {"person_in_bed_medium_dark_skin_tone", "\U0001F6CC\U0001F3FE", 4},
-  {"person_in_bed_dark_skin_tone", "\U0001F6CC\U0001F3FF", 4},
-  {"people_holding_hands", "\U0001F9D1\U0000200D\U0001F91D\U0000200D\U0001F9D1", 12},
-  {"people_holding_hands_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", 12},
-  {"people_holding_hands_light_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", 12},
-  {"people_holding_hands_light_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", 12},
-  {"people_holding_hands_light_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", 12},
-  {"people_holding_hands_light_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", 12},
-  {"people_holding_hands_medium_light_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", 12},
-  {"people_holding_hands_medium_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", 12},
-  {"people_holding_hands_medium_light_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", 12},
-  {"people_holding_hands_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", 12},
-  {"people_holding_hands_medium_light_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", 12},
-  {"people_holding_hands_medium_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", 12},
-  {"people_holding_hands_medium_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", 12},
-  {"people_holding_hands_medium_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", 12},
-  {"people_holding_hands_medium_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", 12},
-  {"people_holding_hands_medium_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", 12},
-  {"people_holding_hands_medium_dark_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", 12},
-  {"people_holding_hands_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", 12},
-  {"people_holding_hands_medium_dark_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", 12},
-  {"people_holding_hands_medium_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", 12},
-  {"people_holding_hands_medium_dark_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", 12},
-  {"people_holding_hands_dark_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", 12},
-  {"people_holding_hands_dark_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", 12},
-  {"people_holding_hands_dark_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", 12},
-  {"people_holding_hands_dark_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", 12},
-  {"people_holding_hands_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", 12},
-  {"women_holding_hands", "\U0001F46D", 1},
-  {"women_holding_hands_light_skin_tone", "\U0001F46D\U0001F3FB", 12},
-  {"women_holding_hands_light_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", 12},
-  {"women_holding_hands_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", 12},
-  {"women_holding_hands_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", 12},
-  {"women_holding_hands_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", 12},
-  {"women_holding_hands_medium_light_skin_tone_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", 12},
-  {"women_holding_hands_medium_light_skin_tone", "\U0001F46D\U0001F3FC", 12},
-  {"women_holding_hands_medium_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", 12},
-  {"women_holding_hands_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", 12},
-  {"women_holding_hands_medium_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", 12},
-  {"women_holding_hands_medium_skin_tone_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", 12},
-  {"women_holding_hands_medium_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", 12},
-  {"women_holding_hands_medium_skin_tone", "\U0001F46D\U0001F3FD", 12},
-  {"women_holding_hands_medium_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", 12},
-  {"women_holding_hands_medium_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", 12},
-  {"women_holding_hands_medium_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", 12},
-  {"women_holding_hands_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", 12},
-  {"women_holding_hands_medium_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", 12},
-  {"women_holding_hands_medium_dark_skin_tone", "\U0001F46D\U0001F3FE", 12},
-  {"women_holding_hands_medium_dark_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", 12},
-  {"women_holding_hands_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", 12},
-  {"women_holding_hands_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", 12},
-  {"women_holding_hands_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", 12},
-  {"women_holding_hands_dark_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", 12},
-  {"women_holding_hands_dark_skin_tone", "\U0001F46D\U0001F3FF", 12},
-  {"woman_and_man_holding_hands", "\U0001F46B", 0},
-  {"woman_and_man_holding_hands_light_skin_tone", "\U0001F46B\U0001F3FB", 12},
-  {"woman_and_man_holding_hands_light_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"woman_and_man_holding_hands_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"woman_and_man_holding_hands_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"woman_and_man_holding_hands_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"woman_and_man_holding_hands_medium_light_skin_tone_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"woman_and_man_holding_hands_medium_light_skin_tone", "\U0001F46B\U0001F3FC", 12},
-  {"woman_and_man_holding_hands_medium_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"woman_and_man_holding_hands_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"woman_and_man_holding_hands_medium_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"woman_and_man_holding_hands_medium_skin_tone_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"woman_and_man_holding_hands_medium_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"woman_and_man_holding_hands_medium_skin_tone", "\U0001F46B\U0001F3FD", 12},
-  {"woman_and_man_holding_hands_medium_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"woman_and_man_holding_hands_medium_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"woman_and_man_holding_hands_medium_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"woman_and_man_holding_hands_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"woman_and_man_holding_hands_medium_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"woman_and_man_holding_hands_medium_dark_skin_tone", "\U0001F46B\U0001F3FE", 12},
-  {"woman_and_man_holding_hands_medium_dark_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"woman_and_man_holding_hands_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"woman_and_man_holding_hands_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"woman_and_man_holding_hands_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"woman_and_man_holding_hands_dark_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"woman_and_man_holding_hands_dark_skin_tone", "\U0001F46B\U0001F3FF", 12},
-  {"men_holding_hands", "\U0001F46C", 1},
-  {"men_holding_hands_light_skin_tone", "\U0001F46C\U0001F3FB", 12},
-  {"men_holding_hands_light_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"men_holding_hands_light_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"men_holding_hands_light_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"men_holding_hands_light_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"men_holding_hands_medium_light_skin_tone_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"men_holding_hands_medium_light_skin_tone", "\U0001F46C\U0001F3FC", 12},
-  {"men_holding_hands_medium_light_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"men_holding_hands_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"men_holding_hands_medium_light_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"men_holding_hands_medium_skin_tone_light_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"men_holding_hands_medium_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"men_holding_hands_medium_skin_tone", "\U0001F46C\U0001F3FD", 12},
-  {"men_holding_hands_medium_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"men_holding_hands_medium_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"men_holding_hands_medium_dark_skin_tone_light_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"men_holding_hands_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"men_holding_hands_medium_dark_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"men_holding_hands_medium_dark_skin_tone", "\U0001F46C\U0001F3FE", 12},
-  {"men_holding_hands_medium_dark_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", 12},
-  {"men_holding_hands_dark_skin_tone_light_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", 12},
-  {"men_holding_hands_dark_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", 12},
-  {"men_holding_hands_dark_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", 12},
-  {"men_holding_hands_dark_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", 12},
-  {"men_holding_hands_dark_skin_tone", "\U0001F46C\U0001F3FF", 12},
-  {"kiss", "\U0001F48F", 0},
-  {"kiss_light_skin_tone", "\U0001F48F\U0001F3FB", 13},
-  {"kiss_medium_light_skin_tone", "\U0001F48F\U0001F3FC", 13},
-  {"kiss_medium_skin_tone", "\U0001F48F\U0001F3FD", 13},
-  {"kiss_medium_dark_skin_tone", "\U0001F48F\U0001F3FE", 13},
-  {"kiss_dark_skin_tone", "\U0001F48F\U0001F3FF", 13},
-  {"kiss_person_person_light_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"kiss_person_person_light_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"kiss_person_person_light_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"kiss_person_person_light_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"kiss_person_person_medium_light_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"kiss_person_person_medium_light_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"kiss_person_person_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"kiss_person_person_medium_light_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"kiss_person_person_medium_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"kiss_person_person_medium_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"kiss_person_person_medium_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"kiss_person_person_medium_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"kiss_person_person_medium_dark_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"kiss_person_person_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"kiss_person_person_medium_dark_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"kiss_person_person_medium_dark_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"kiss_person_person_dark_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"kiss_person_person_dark_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"kiss_person_person_dark_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"kiss_person_person_dark_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"kiss_woman_man", "\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468", 2},
-  {"kiss_woman_man_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_woman_man_light_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_woman_man_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_woman_man_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_woman_man_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_woman_man_medium_light_skin_tone_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_woman_man_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_woman_man_medium_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_woman_man_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_woman_man_medium_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_woman_man_medium_skin_tone_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_woman_man_medium_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_woman_man_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_woman_man_medium_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_woman_man_medium_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_woman_man_medium_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_woman_man_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_woman_man_medium_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_woman_man_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_woman_man_medium_dark_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_woman_man_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_woman_man_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_woman_man_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_woman_man_dark_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_woman_man_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_man_man", "\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468", 2},
-  {"kiss_man_man_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_man_man_light_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_man_man_light_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_man_man_light_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_man_man_light_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_man_man_medium_light_skin_tone_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_man_man_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_man_man_medium_light_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_man_man_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_man_man_medium_light_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_man_man_medium_skin_tone_light_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_man_man_medium_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_man_man_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_man_man_medium_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_man_man_medium_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_man_man_medium_dark_skin_tone_light_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_man_man_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_man_man_medium_dark_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_man_man_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_man_man_medium_dark_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_man_man_dark_skin_tone_light_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", 13},
-  {"kiss_man_man_dark_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", 13},
-  {"kiss_man_man_dark_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", 13},
-  {"kiss_man_man_dark_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", 13},
-  {"kiss_man_man_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", 13},
-  {"kiss_woman_woman", "\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469", 2},
-  {"kiss_woman_woman_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", 13},
-  {"kiss_woman_woman_light_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", 13},
-  {"kiss_woman_woman_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", 13},
-  {"kiss_woman_woman_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", 13},
-  {"kiss_woman_woman_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", 13},
-  {"kiss_woman_woman_medium_light_skin_tone_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", 13},
-  {"kiss_woman_woman_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", 13},
-  {"kiss_woman_woman_medium_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", 13},
-  {"kiss_woman_woman_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", 13},
-  {"kiss_woman_woman_medium_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", 13},
-  {"kiss_woman_woman_medium_skin_tone_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", 13},
-  {"kiss_woman_woman_medium_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", 13},
-  {"kiss_woman_woman_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", 13},
-  {"kiss_woman_woman_medium_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", 13},
-  {"kiss_woman_woman_medium_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", 13},
-  {"kiss_woman_woman_medium_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", 13},
-  {"kiss_woman_woman_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", 13},
-  {"kiss_woman_woman_medium_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", 13},
-  {"kiss_woman_woman_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", 13},
-  {"kiss_woman_woman_medium_dark_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", 13},
-  {"kiss_woman_woman_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", 13},
-  {"kiss_woman_woman_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", 13},
-  {"kiss_woman_woman_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", 13},
-  {"kiss_woman_woman_dark_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", 13},
-  {"kiss_woman_woman_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", 13},
-  {"couple_with_heart", "\U0001F491", 0},
-  {"couple_with_heart_light_skin_tone", "\U0001F491\U0001F3FB", 13},
-  {"couple_with_heart_medium_light_skin_tone", "\U0001F491\U0001F3FC", 13},
-  {"couple_with_heart_medium_skin_tone", "\U0001F491\U0001F3FD", 13},
-  {"couple_with_heart_medium_dark_skin_tone", "\U0001F491\U0001F3FE", 13},
-  {"couple_with_heart_dark_skin_tone", "\U0001F491\U0001F3FF", 13},
-  {"couple_with_heart_person_person_light_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"couple_with_heart_person_person_light_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"couple_with_heart_person_person_light_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"couple_with_heart_person_person_light_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"couple_with_heart_person_person_medium_light_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"couple_with_heart_person_person_medium_light_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"couple_with_heart_person_person_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"couple_with_heart_person_person_medium_light_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"couple_with_heart_person_person_medium_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"couple_with_heart_person_person_medium_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"couple_with_heart_person_person_medium_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"couple_with_heart_person_person_medium_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"couple_with_heart_person_person_medium_dark_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"couple_with_heart_person_person_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"couple_with_heart_person_person_medium_dark_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"couple_with_heart_person_person_medium_dark_skin_tone_dark_skin_tone", "\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", 13},
-  {"couple_with_heart_person_person_dark_skin_tone_light_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", 13},
-  {"couple_with_heart_person_person_dark_skin_tone_medium_light_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", 13},
-  {"couple_with_heart_person_person_dark_skin_tone_medium_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", 13},
-  {"couple_with_heart_person_person_dark_skin_tone_medium_dark_skin_tone", "\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", 13},
-  {"couple_with_heart_woman_man", "\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468", 2},
-  {"couple_with_heart_woman_man_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_woman_man_light_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_woman_man_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_woman_man_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_woman_man_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_woman_man_medium_light_skin_tone_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_woman_man_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_woman_man_medium_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_woman_man_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_woman_man_medium_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_woman_man_medium_skin_tone_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_woman_man_medium_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_woman_man_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_woman_man_medium_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_woman_man_medium_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_woman_man_medium_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_woman_man_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_woman_man_medium_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_woman_man_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_woman_man_medium_dark_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_woman_man_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_woman_man_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_woman_man_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_woman_man_dark_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_woman_man_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_man_man", "\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468", 2},
-  {"couple_with_heart_man_man_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_man_man_light_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_man_man_light_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_man_man_light_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_man_man_light_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_man_man_medium_light_skin_tone_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_man_man_medium_light_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_man_man_medium_light_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_man_man_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_man_man_medium_light_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_man_man_medium_skin_tone_light_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_man_man_medium_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_man_man_medium_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_man_man_medium_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_man_man_medium_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_man_man_medium_dark_skin_tone_light_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_man_man_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_man_man_medium_dark_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_man_man_medium_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_man_man_medium_dark_skin_tone_dark_skin_tone", "\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_man_man_dark_skin_tone_light_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", 13},
-  {"couple_with_heart_man_man_dark_skin_tone_medium_light_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", 13},
-  {"couple_with_heart_man_man_dark_skin_tone_medium_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", 13},
-  {"couple_with_heart_man_man_dark_skin_tone_medium_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", 13},
-  {"couple_with_heart_man_man_dark_skin_tone", "\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", 13},
-  {"couple_with_heart_woman_woman", "\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469", 2},
-  {"couple_with_heart_woman_woman_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", 13},
-  {"couple_with_heart_woman_woman_light_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", 13},
-  {"couple_with_heart_woman_woman_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", 13},
-  {"couple_with_heart_woman_woman_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", 13},
-  {"couple_with_heart_woman_woman_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", 13},
-  {"couple_with_heart_woman_woman_medium_light_skin_tone_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", 13},
-  {"couple_with_heart_woman_woman_medium_light_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", 13},
-  {"couple_with_heart_woman_woman_medium_light_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", 13},
-  {"couple_with_heart_woman_woman_medium_light_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", 13},
-  {"couple_with_heart_woman_woman_medium_light_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", 13},
-  {"couple_with_heart_woman_woman_medium_skin_tone_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", 13},
-  {"couple_with_heart_woman_woman_medium_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", 13},
-  {"couple_with_heart_woman_woman_medium_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", 13},
-  {"couple_with_heart_woman_woman_medium_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", 13},
-  {"couple_with_heart_woman_woman_medium_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", 13},
-  {"couple_with_heart_woman_woman_medium_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", 13},
-  {"couple_with_heart_woman_woman_medium_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", 13},
-  {"couple_with_heart_woman_woman_medium_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", 13},
-  {"couple_with_heart_woman_woman_medium_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", 13},
-  {"couple_with_heart_woman_woman_medium_dark_skin_tone_dark_skin_tone", "\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", 13},
-  {"couple_with_heart_woman_woman_dark_skin_tone_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", 13},
-  {"couple_with_heart_woman_woman_dark_skin_tone_medium_light_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", 13},
-  {"couple_with_heart_woman_woman_dark_skin_tone_medium_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", 13},
-  {"couple_with_heart_woman_woman_dark_skin_tone_medium_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", 13},
-  {"couple_with_heart_woman_woman_dark_skin_tone", "\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", 13},
-  {"family", "\U0001F46A", 0},
-  {"family_man_woman_boy", "\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466", 2},
-  {"family_man_woman_girl", "\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467", 2},
-  {"family_man_woman_girl_boy", "\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466", 2},
-  {"family_man_woman_boy_boy", "\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466", 2},
-  {"family_man_woman_girl_girl", "\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467", 2},
-  {"family_man_man_boy", "\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466", 2},
-  {"family_man_man_girl", "\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467", 2},
-  {"family_man_man_girl_boy", "\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466", 2},
-  {"family_man_man_boy_boy", "\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466", 2},
-  {"family_man_man_girl_girl", "\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467", 2},
-  {"family_woman_woman_boy", "\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466", 2},
-  {"family_woman_woman_girl", "\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467", 2},
-  {"family_woman_woman_girl_boy", "\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466", 2},
-  {"family_woman_woman_boy_boy", "\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466", 2},
-  {"family_woman_woman_girl_girl", "\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467", 2},
-  {"family_man_boy", "\U0001F468\U0000200D\U0001F466", 4},
-  {"family_man_boy_boy", "\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466", 4},
-  {"family_man_girl", "\U0001F468\U0000200D\U0001F467", 4},
-  {"family_man_girl_boy", "\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466", 4},
-  {"family_man_girl_girl", "\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467", 4},
-  {"family_woman_boy", "\U0001F469\U0000200D\U0001F466", 4},
-  {"family_woman_boy_boy", "\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466", 4},
-  {"family_woman_girl", "\U0001F469\U0000200D\U0001F467", 4},
-  {"family_woman_girl_boy", "\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466", 4},
-  {"family_woman_girl_girl", "\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467", 4},
-  {"speaking_head", "\U0001F5E3", 0},
-  {"bust_in_silhouette", "\U0001F464", 0},
-  {"busts_in_silhouette", "\U0001F465", 1},
-  {"people_hugging", "\U0001FAC2", 13},
-  {"footprints", "\U0001F463", 0},
-  {"monkey_face", "\U0001F435", 0},
-  {"monkey", "\U0001F412", 0},
-  {"gorilla", "\U0001F98D", 3},
-  {"orangutan", "\U0001F9A7", 12},
-  {"dog_face", "\U0001F436", 0},
-  {"dog", "\U0001F415", 0},
-  {"guide_dog", "\U0001F9AE", 12},
-  {"service_dog", "\U0001F415\U0000200D\U0001F9BA", 12},
-  {"poodle", "\U0001F429", 0},
-  {"wolf", "\U0001F43A", 0},
-  {"fox", "\U0001F98A", 3},
-  {"raccoon", "\U0001F99D", 11},
-  {"cat_face", "\U0001F431", 0},
-  {"cat", "\U0001F408", 0},
-  {"black_cat", "\U0001F408\U0000200D\U00002B1B", 13},
-  {"lion", "\U0001F981", 1},
-  {"tiger_face", "\U0001F42F", 0},
-  {"tiger", "\U0001F405", 1},
-  {"leopard", "\U0001F406", 1},
-  {"horse_face", "\U0001F434", 0},
-  {"horse", "\U0001F40E", 0},
-  {"unicorn", "\U0001F984", 1},
-  {"zebra", "\U0001F993", 5},
-  {"deer", "\U0001F98C", 3},
-  {"bison", "\U0001F9AC", 13},
-  {"cow_face", "\U0001F42E", 0},
-  {"ox", "\U0001F402", 1},
-  {"water_buffalo", "\U0001F403", 1},
-  {"cow", "\U0001F404", 1},
-  {"pig_face", "\U0001F437", 0},
-  {"pig", "\U0001F416", 1},
-  {"boar", "\U0001F417", 0},
-  {"pig_nose", "\U0001F43D", 0},
-  {"ram", "\U0001F40F", 1},
-  {"ewe", "\U0001F411", 0},
-  {"goat", "\U0001F410", 1},
-  {"camel", "\U0001F42A", 1},
-  {"two_hump_camel", "\U0001F42B", 0},
-  {"llama", "\U0001F999", 11},
-  {"giraffe", "\U0001F992", 5},
-  {"elephant", "\U0001F418", 0},
-  {"mammoth", "\U0001F9A3", 13},
-  {"rhinoceros", "\U0001F98F", 3},
-  {"hippopotamus", "\U0001F99B", 11},
-  {"mouse_face", "\U0001F42D", 0},
-  {"mouse", "\U0001F401", 1},
-  {"rat", "\U0001F400", 1},
-  {"hamster", "\U0001F439", 0},
-  {"rabbit_face", "\U0001F430", 0},
-  {"rabbit", "\U0001F407", 1},
-  {"chipmunk", "\U0001F43F", 0},
-  {"beaver", "\U0001F9AB", 13},
-  {"hedgehog", "\U0001F994", 5},
-  {"bat", "\U0001F987", 3},
-  {"bear", "\U0001F43B", 0},
-  {"polar_bear", "\U0001F43B\U0000200D\U00002744\U0000FE0F", 13},
-  {"koala", "\U0001F428", 0},
-  {"panda", "\U0001F43C", 0},
-  {"sloth", "\U0001F9A5", 12},
-  {"otter", "\U0001F9A6", 12},
-  {"skunk", "\U0001F9A8", 12},
-  {"kangaroo", "\U0001F998", 11},
-  {"badger", "\U0001F9A1", 11},
-  {"paw_prints", "\U0001F43E", 0},
-  {"turkey", "\U0001F983", 1},
-  {"chicken", "\U0001F414", 0},
-  {"rooster", "\U0001F413", 1},
-  {"hatching_chick", "\U0001F423", 0},
-  {"baby_chick", "\U0001F424", 0},
-  {"front_facing_baby_chick", "\U0001F425", 0},
-  {"bird", "\U0001F426", 0},
-  {"penguin", "\U0001F427", 0},
-  {"dove", "\U0001F54A", 0},
-  {"eagle", "\U0001F985", 3},
-  {"duck", "\U0001F986", 3},
-  {"swan", "\U0001F9A2", 11},
-  {"owl", "\U0001F989", 3},
-  {"dodo", "\U0001F9A4", 13},
-  {"feather", "\U0001FAB6", 13},
-  {"flamingo", "\U0001F9A9", 12},
-  {"peacock", "\U0001F99A", 11},
-  {"parrot", "\U0001F99C", 11},
-  {"frog", "\U0001F438", 0},
-  {"crocodile", "\U0001F40A", 1},
-  {"turtle", "\U0001F422", 0},
-  {"lizard", "\U0001F98E", 3},
-  {"snake", "\U0001F40D", 0},
-  {"dragon_face", "\U0001F432", 0},
-  {"dragon", "\U0001F409", 1},
-  {"sauropod", "\U0001F995", 5},
-  {"t_rex", "\U0001F996", 5},
-  {"spouting_whale", "\U0001F433", 0},
-  {"whale", "\U0001F40B", 1},
-  {"dolphin", "\U0001F42C", 0},
-  {"seal", "\U0001F9AD", 13},
-  {"fish", "\U0001F41F", 0},
-  {"tropical_fish", "\U0001F420", 0},
-  {"blowfish", "\U0001F421", 0},
-  {"shark", "\U0001F988", 3},
-  {"octopus", "\U0001F419", 0},
-  {"spiral_shell", "\U0001F41A", 0},
-  {"coral", "\U0001FAB8", 14},
-  {"snail", "\U0001F40C", 0},
-  {"butterfly", "\U0001F98B", 3},
-  {"bug", "\U0001F41B", 0},
-  {"ant", "\U0001F41C", 0},
-  {"honeybee", "\U0001F41D", 0},
-  {"beetle", "\U0001FAB2", 13},
-  {"lady_beetle", "\U0001F41E", 0},
-  {"cricket", "\U0001F997", 5},
-  {"cockroach", "\U0001FAB3", 13},
-  {"spider", "\U0001F577", 0},
-  {"spider_web", "\U0001F578", 0},
-  {"scorpion", "\U0001F982", 1},
-  {"mosquito", "\U0001F99F", 11},
-  {"fly", "\U0001FAB0", 13},
-  {"worm", "\U0001FAB1", 13},
-  {"microbe", "\U0001F9A0", 11},
-  {"bouquet", "\U0001F490", 0},
-  {"cherry_blossom", "\U0001F338", 0},
-  {"white_flower", "\U0001F4AE", 0},
-  {"lotus", "\U0001FAB7", 14},
-  {"rosette", "\U0001F3F5", 0},
-  {"rose", "\U0001F339", 0},
-  {"wilted_flower", "\U0001F940", 3},
-  {"hibiscus", "\U0001F33A", 0},
-  {"sunflower", "\U0001F33B", 0},
-  {"blossom", "\U0001F33C", 0},
-  {"tulip", "\U0001F337", 0},
-  {"seedling", "\U0001F331", 0},
-  {"potted_plant", "\U0001FAB4", 13},
-  {"evergreen_tree", "\U0001F332", 1},
-  {"deciduous_tree", "\U0001F333", 1},
-  {"palm_tree", "\U0001F334", 0},
-  {"cactus", "\U0001F335", 0},
-  {"sheaf_of_rice", "\U0001F33E", 0},
-  {"herb", "\U0001F33F", 0},
-  {"shamrock", "\U00002618", 1},
-  {"four_leaf_clover", "\U0001F340", 0},
-  {"maple_leaf", "\U0001F341", 0},
-  {"fallen_leaf", "\U0001F342", 0},
-  {"leaf_fluttering_in_wind", "\U0001F343", 0},
-  {"empty_nest", "\U0001FAB9", 14},
-  {"nest_with_eggs", "\U0001FABA", 14},
-  {"grapes", "\U0001F347", 0},
-  {"melon", "\U0001F348", 0},
-  {"watermelon", "\U0001F349", 0},
-  {"tangerine", "\U0001F34A", 0},
-  {"lemon", "\U0001F34B", 1},
-  {"banana", "\U0001F34C", 0},
-  {"pineapple", "\U0001F34D", 0},
-  {"mango", "\U0001F96D", 11},
-  {"red_apple", "\U0001F34E", 0},
-  {"green_apple", "\U0001F34F", 0},
-  {"pear", "\U0001F350", 1},
-  {"peach", "\U0001F351", 0},
-  {"cherries", "\U0001F352", 0},
-  {"strawberry", "\U0001F353", 0},
-  {"blueberries", "\U0001FAD0", 13},
-  {"kiwi_fruit", "\U0001F95D", 3},
-  {"tomato", "\U0001F345", 0},
-  {"olive", "\U0001FAD2", 13},
-  {"coconut", "\U0001F965", 5},
-  {"avocado", "\U0001F951", 3},
-  {"eggplant", "\U0001F346", 0},
-  {"potato", "\U0001F954", 3},
-  {"carrot", "\U0001F955", 3},
-  {"ear_of_corn", "\U0001F33D", 0},
-  {"hot_pepper", "\U0001F336", 0},
-  {"bell_pepper", "\U0001FAD1", 13},
-  {"cucumber", "\U0001F952", 3},
-  {"leafy_green", "\U0001F96C", 11},
-  {"broccoli", "\U0001F966", 5},
-  {"garlic", "\U0001F9C4", 12},
-  {"onion", "\U0001F9C5", 12},
-  {"mushroom", "\U0001F344", 0},
-  {"peanuts", "\U0001F95C", 3},
-  {"beans", "\U0001FAD8", 14},
-  {"chestnut", "\U0001F330", 0},
-  {"bread", "\U0001F35E", 0},
-  {"croissant", "\U0001F950", 3},
-  {"baguette_bread", "\U0001F956", 3},
-  {"flatbread", "\U0001FAD3", 13},
-  {"pretzel", "\U0001F968", 5},
-  {"bagel", "\U0001F96F", 11},
-  {"pancakes", "\U0001F95E", 3},
-  {"waffle", "\U0001F9C7", 12},
-  {"cheese_wedge", "\U0001F9C0", 1},
-  {"meat_on_bone", "\U0001F356", 0},
-  {"poultry_leg", "\U0001F357", 0},
-  {"cut_of_meat", "\U0001F969", 5},
-  {"bacon", "\U0001F953", 3},
-  {"hamburger", "\U0001F354", 0},
-  {"french_fries", "\U0001F35F", 0},
-  {"pizza", "\U0001F355", 0},
-  {"hot_dog", "\U0001F32D", 1},
-  {"sandwich", "\U0001F96A", 5},
-  {"taco", "\U0001F32E", 1},
-  {"burrito", "\U0001F32F", 1},
-  {"tamale", "\U0001FAD4", 13},
-  {"stuffed_flatbread", "\U0001F959", 3},
-  {"falafel", "\U0001F9C6", 12},
-  {"egg", "\U0001F95A", 3},
-  {"cooking", "\U0001F373", 0},
-  {"shallow_pan_of_food", "\U0001F958", 3},
-  {"pot_of_food", "\U0001F372", 0},
-  {"fondue", "\U0001FAD5", 13},
-  {"bowl_with_spoon", "\U0001F963", 5},
-  {"green_salad", "\U0001F957", 3},
-  {"popcorn", "\U0001F37F", 1},
-  {"butter", "\U0001F9C8", 12},
-  {"salt", "\U0001F9C2", 11},
-  {"canned_food", "\U0001F96B", 5},
-  {"bento_box", "\U0001F371", 0},
-  {"rice_cracker", "\U0001F358", 0},
-  {"rice_ball", "\U0001F359", 0},
-  {"cooked_rice", "\U0001F35A", 0},
-  {"curry_rice", "\U0001F35B", 0},
-  {"steaming_bowl", "\U0001F35C", 0},
-  {"spaghetti", "\U0001F35D", 0},
-  {"roasted_sweet_potato", "\U0001F360", 0},
-  {"oden", "\U0001F362", 0},
-  {"sushi", "\U0001F363", 0},
-  {"fried_shrimp", "\U0001F364", 0},
-  {"fish_cake_with_swirl", "\U0001F365", 0},
-  {"moon_cake", "\U0001F96E", 11},
-  {"dango", "\U0001F361", 0},
-  {"dumpling", "\U0001F95F", 5},
-  {"fortune_cookie", "\U0001F960", 5},
-  {"takeout_box", "\U0001F961", 5},
-  {"crab", "\U0001F980", 1},
-  {"lobster", "\U0001F99E", 11},
-  {"shrimp", "\U0001F990", 3},
-  {"squid", "\U0001F991", 3},
-  {"oyster", "\U0001F9AA", 12},
-  {"soft_ice_cream", "\U0001F366", 0},
-  {"shaved_ice", "\U0001F367", 0},
-  {"ice_cream", "\U0001F368", 0},
-  {"doughnut", "\U0001F369", 0},
-  {"cookie", "\U0001F36A", 0},
-  {"birthday_cake", "\U0001F382", 0},
-  {"shortcake", "\U0001F370", 0},
-  {"cupcake", "\U0001F9C1", 11},
-  {"pie", "\U0001F967", 5},
-  {"chocolate_bar", "\U0001F36B", 0},
-  {"candy", "\U0001F36C", 0},
-  {"lollipop", "\U0001F36D", 0},
-  {"custard", "\U0001F36E", 0},
-  {"honey_pot", "\U0001F36F", 0},
-  {"baby_bottle", "\U0001F37C", 1},
-  {"glass_of_milk", "\U0001F95B", 3},
-  {"hot_beverage", "\U00002615", 0},
-  {"teapot", "\U0001FAD6", 13},
-  {"teacup_without_handle", "\U0001F375", 0},
-  {"sake", "\U0001F376", 0},
-  {"bottle_with_popping_cork", "\U0001F37E", 1},
-  {"wine_glass", "\U0001F377", 0},
-  {"cocktail_glass", "\U0001F378", 0},
-  {"tropical_drink", "\U0001F379", 0},
-  {"beer_mug", "\U0001F37A", 0},
-  {"clinking_beer_mugs", "\U0001F37B", 0},
-  {"clinking_glasses", "\U0001F942", 3},
-  {"tumbler_glass", "\U0001F943", 3},
-  {"pouring_liquid", "\U0001FAD7", 14},
-  {"cup_with_straw", "\U0001F964", 5},
-  {"bubble_tea", "\U0001F9CB", 13},
-  {"beverage_box", "\U0001F9C3", 12},
-  {"mate", "\U0001F9C9", 12},
-  {"ice", "\U0001F9CA", 12},
-  {"chopsticks", "\U0001F962", 5},
-  {"fork_and_knife_with_plate", "\U0001F37D", 0},
-  {"fork_and_knife", "\U0001F374", 0},
-  {"spoon", "\U0001F944", 3},
-  {"kitchen_knife", "\U0001F52A", 0},
-  {"jar", "\U0001FAD9", 14},
-  {"amphora", "\U0001F3FA", 1},
-  {"globe_showing_europe_africa", "\U0001F30D", 0},
-  {"globe_showing_americas", "\U0001F30E", 0},
-  {"globe_showing_asia_australia", "\U0001F30F", 0},
-  {"globe_with_meridians", "\U0001F310", 1},
-  {"world_map", "\U0001F5FA", 0},
-  {"map_of_japan", "\U0001F5FE", 0},
-  {"compass", "\U0001F9ED", 11},
-  {"snow_capped_mountain", "\U0001F3D4", 0},
-  {"mountain", "\U000026F0", 0},
-  {"volcano", "\U0001F30B", 0},
-  {"mount_fuji", "\U0001F5FB", 0},
-  {"camping", "\U0001F3D5", 0},
-  {"beach_with_umbrella", "\U0001F3D6", 0},
-  {"desert", "\U0001F3DC", 0},
-  {"desert_island", "\U0001F3DD", 0},
-  {"national_park", "\U0001F3DE", 0},
-  {"stadium", "\U0001F3DF", 0},
-  {"classical_building", "\U0001F3DB", 0},
-  {"building_construction", "\U0001F3D7", 0},
-  {"brick", "\U0001F9F1", 11},
-  {"rock", "\U0001FAA8", 13},
-  {"wood", "\U0001FAB5", 13},
-  {"hut", "\U0001F6D6", 13},
-  {"houses", "\U0001F3D8", 0},
-  {"derelict_house", "\U0001F3DA", 0},
-  {"house", "\U0001F3E0", 0},
-  {"house_with_garden", "\U0001F3E1", 0},
-  {"office_building", "\U0001F3E2", 0},
-  {"japanese_post_office", "\U0001F3E3", 0},
-  {"post_office", "\U0001F3E4", 1},
-  {"hospital", "\U0001F3E5", 0},
-  {"bank", "\U0001F3E6", 0},
-  {"hotel", "\U0001F3E8", 0},
-  {"love_hotel", "\U0001F3E9", 0},
-  {"convenience_store", "\U0001F3EA", 0},
-  {"school", "\U0001F3EB", 0},
-  {"department_store", "\U0001F3EC", 0},
-  {"factory", "\U0001F3ED", 0},
-  {"japanese_castle", "\U0001F3EF", 0},
-  {"castle", "\U0001F3F0", 0},
-  {"wedding", "\U0001F492", 0},
-  {"tokyo_tower", "\U0001F5FC", 0},
-  {"statue_of_liberty", "\U0001F5FD", 0},
-  {"church", "\U000026EA", 0},
-  {"mosque", "\U0001F54C", 1},
-  {"hindu_temple", "\U0001F6D5", 12},
-  {"synagogue", "\U0001F54D", 1},
-  {"shinto_shrine", "\U000026E9", 0},
-  {"kaaba", "\U0001F54B", 1},
-  {"fountain", "\U000026F2", 0},
-  {"tent", "\U000026FA", 0},
-  {"foggy", "\U0001F301", 0},
-  {"night_with_stars", "\U0001F303", 0},
-  {"cityscape", "\U0001F3D9", 0},
-  {"sunrise_over_mountains", "\U0001F304", 0},
-  {"sunrise", "\U0001F305", 0},
-  {"cityscape_at_dusk", "\U0001F306", 0},
-  {"sunset", "\U0001F307", 0},
-  {"bridge_at_night", "\U0001F309", 0},
-  {"hot_springs", "\U00002668", 0},
-  {"carousel_horse", "\U0001F3A0", 0},
-  {"playground_slide", "\U0001F6DD", 14},
-  {"ferris_wheel", "\U0001F3A1", 0},
-  {"roller_coaster", "\U0001F3A2", 0},
-  {"barber_pole", "\U0001F488", 0},
-  {"circus_tent", "\U0001F3AA", 0},
-  {"locomotive", "\U0001F682", 1},
-  {"railway_car", "\U0001F683", 0},
-  {"high_speed_train", "\U0001F684", 0},
-  {"bullet_train", "\U0001F685", 0},
-  {"train", "\U0001F686", 1},
-  {"metro", "\U0001F687", 0},
-  {"light_rail", "\U0001F688", 1},
-  {"station", "\U0001F689", 0},
-  {"tram", "\U0001F68A", 1},
-  {"monorail", "\U0001F69D", 1},
-  {"mountain_railway", "\U0001F69E", 1},
-  {"tram_car", "\U0001F68B", 1},
-  {"bus", "\U0001F68C", 0},
-  {"oncoming_bus", "\U0001F68D", 0},
-  {"trolleybus", "\U0001F68E", 1},
-  {"minibus", "\U0001F690", 1},
-  {"ambulance", "\U0001F691", 0},
-  {"fire_engine", "\U0001F692", 0},
-  {"police_car", "\U0001F693", 0},
-  {"oncoming_police_car", "\U0001F694", 0},
-  {"taxi", "\U0001F695", 0},
-  {"oncoming_taxi", "\U0001F696", 1},
-  {"automobile", "\U0001F697", 0},
-  {"oncoming_automobile", "\U0001F698", 0},
-  {"sport_utility_vehicle", "\U0001F699", 0},
-  {"pickup_truck", "\U0001F6FB", 13},
-  {"delivery_truck", "\U0001F69A", 0},
-  {"articulated_lorry", "\U0001F69B", 1},
-  {"tractor", "\U0001F69C", 1},
-  {"racing_car", "\U0001F3CE", 0},
-  {"motorcycle", "\U0001F3CD", 0},
-  {"motor_scooter", "\U0001F6F5", 3},
-  {"manual_wheelchair", "\U0001F9BD", 12},
-  {"motorized_wheelchair", "\U0001F9BC", 12},
-  {"auto_rickshaw", "\U0001F6FA", 12},
-  {"bicycle", "\U0001F6B2", 0},
-  {"kick_scooter", "\U0001F6F4", 3},
-  {"skateboard", "\U0001F6F9", 11},
-  {"roller_skate", "\U0001F6FC", 13},
-  {"bus_stop", "\U0001F68F", 0},
-  {"motorway", "\U0001F6E3", 0},
-  {"railway_track", "\U0001F6E4", 0},
-  {"oil_drum", "\U0001F6E2", 0},
-  {"fuel_pump", "\U000026FD", 0},
-  {"wheel", "\U0001F6DE", 14},
-  {"police_car_light", "\U0001F6A8", 0},
-  {"horizontal_traffic_light", "\U0001F6A5", 0},
-  {"vertical_traffic_light", "\U0001F6A6", 1},
-  {"stop_sign", "\U0001F6D1", 3},
-  {"construction", "\U0001F6A7", 0},
-  {"anchor", "\U00002693", 0},
-  {"ring_buoy", "\U0001F6DF", 14},
-  {"sailboat", "\U000026F5", 0},
-  {"canoe", "\U0001F6F6", 3},
-  {"speedboat", "\U0001F6A4", 0},
-  {"passenger_ship", "\U0001F6F3", 0},
-  {"ferry", "\U000026F4", 0},
-  {"motor_boat", "\U0001F6E5", 0},
-  {"ship", "\U0001F6A2", 0},
-  {"airplane", "\U00002708", 0},
-  {"small_airplane", "\U0001F6E9", 0},
-  {"airplane_departure", "\U0001F6EB", 1},
-  {"airplane_arrival", "\U0001F6EC", 1},
-  {"parachute", "\U0001FA82", 12},
-  {"seat", "\U0001F4BA", 0},
-  {"helicopter", "\U0001F681", 1},
-  {"suspension_railway", "\U0001F69F", 1},
-  {"mountain_cableway", "\U0001F6A0", 1},
-  {"aerial_tramway", "\U0001F6A1", 1},
-  {"satellite", "\U0001F6F0", 0},
-  {"rocket", "\U0001F680", 0},
-  {"flying_saucer", "\U0001F6F8", 5},
-  {"bellhop_bell", "\U0001F6CE", 0},
-  {"luggage", "\U0001F9F3", 11},
-  {"hourglass_done", "\U0000231B", 0},
-  {"hourglass_not_done", "\U000023F3", 0},
-  {"watch", "\U0000231A", 0},
-  {"alarm_clock", "\U000023F0", 0},
-  {"stopwatch", "\U000023F1", 1},
-  {"timer_clock", "\U000023F2", 1},
-  {"mantelpiece_clock", "\U0001F570", 0},
-  {"twelve_o’clock", "\U0001F55B", 0},
-  {"twelve_thirty", "\U0001F567", 0},
-  {"one_o’clock", "\U0001F550", 0},
-  {"one_thirty", "\U0001F55C", 0},
-  {"two_o’clock", "\U0001F551", 0},
-  {"two_thirty", "\U0001F55D", 0},
-  {"three_o’clock", "\U0001F552", 0},
-  {"three_thirty", "\U0001F55E", 0},
-  {"four_o’clock", "\U0001F553", 0},
-  {"four_thirty", "\U0001F55F", 0},
-  {"five_o’clock", "\U0001F554", 0},
-  {"five_thirty", "\U0001F560", 0},
-  {"six_o’clock", "\U0001F555", 0},
-  {"six_thirty", "\U0001F561", 0},
-  {"seven_o’clock", "\U0001F556", 0},
-  {"seven_thirty", "\U0001F562", 0},
-  {"eight_o’clock", "\U0001F557", 0},
-  {"eight_thirty", "\U0001F563", 0},
-  {"nine_o’clock", "\U0001F558", 0},
-  {"nine_thirty", "\U0001F564", 0},
-  {"ten_o’clock", "\U0001F559", 0},
-  {"ten_thirty", "\U0001F565", 0},
-  {"eleven_o’clock", "\U0001F55A", 0},
-  {"eleven_thirty", "\U0001F566", 0},
-  {"new_moon", "\U0001F311", 0},
-  {"waxing_crescent_moon", "\U0001F312", 1},
-  {"first_quarter_moon", "\U0001F313", 0},
-  {"waxing_gibbous_moon", "\U0001F314", 0},
-  {"full_moon", "\U0001F315", 0},
-  {"waning_gibbous_moon", "\U0001F316", 1},
-  {"last_quarter_moon", "\U0001F317", 1},
-  {"waning_crescent_moon", "\U0001F318", 1},
-  {"crescent_moon", "\U0001F319", 0},
-  {"new_moon_face", "\U0001F31A", 1},
-  {"first_quarter_moon_face", "\U0001F31B", 0},
-  {"last_quarter_moon_face", "\U0001F31C", 0},
-  {"thermometer", "\U0001F321", 0},
-  {"sun", "\U00002600", 0},
-  {"full_moon_face", "\U0001F31D", 1},
-  {"sun_with_face", "\U0001F31E", 1},
-  {"ringed_planet", "\U0001FA90", 12},
-  {"star", "\U00002B50", 0},
-  {"glowing_star", "\U0001F31F", 0},
-  {"shooting_star", "\U0001F320", 0},
-  {"milky_way", "\U0001F30C", 0},
-  {"cloud", "\U00002601", 0},
-  {"sun_behind_cloud", "\U000026C5", 0},
-  {"cloud_with_lightning_and_rain", "\U000026C8", 0},
-  {"sun_behind_small_cloud", "\U0001F324", 0},
-  {"sun_behind_large_cloud", "\U0001F325", 0},
-  {"sun_behind_rain_cloud", "\U0001F326", 0},
-  {"cloud_with_rain", "\U0001F327", 0},
-  {"cloud_with_snow", "\U0001F328", 0},
-  {"cloud_with_lightning", "\U0001F329", 0},
-  {"tornado", "\U0001F32A", 0},
-  {"fog", "\U0001F32B", 0},
-  {"wind_face", "\U0001F32C", 0},
-  {"cyclone", "\U0001F300", 0},
-  {"rainbow", "\U0001F308", 0},
-  {"closed_umbrella", "\U0001F302", 0},
-  {"umbrella", "\U00002602", 0},
-  {"umbrella_with_rain_drops", "\U00002614", 0},
-  {"umbrella_on_ground", "\U000026F1", 0},
-  {"high_voltage", "\U000026A1", 0},
-  {"snowflake", "\U00002744", 0},
-  {"snowman", "\U00002603", 0},
-  {"snowman_without_snow", "\U000026C4", 0},
-  {"comet", "\U00002604", 1},
-  {"fire", "\U0001F525", 0},
-  {"droplet", "\U0001F4A7", 0},
-  {"water_wave", "\U0001F30A", 0},
-  {"jack_o_lantern", "\U0001F383", 0},
-  {"christmas_tree", "\U0001F384", 0},
-  {"fireworks", "\U0001F386", 0},
-  {"sparkler", "\U0001F387", 0},
-  {"firecracker", "\U0001F9E8", 11},
-  {"sparkles", "\U00002728", 0},
-  {"balloon", "\U0001F388", 0},
-  {"party_popper", "\U0001F389", 0},
-  {"confetti_ball", "\U0001F38A", 0},
-  {"tanabata_tree", "\U0001F38B", 0},
-  {"pine_decoration", "\U0001F38D", 0},
-  {"japanese_dolls", "\U0001F38E", 0},
-  {"carp_streamer", "\U0001F38F", 0},
-  {"wind_chime", "\U0001F390", 0},
-  {"moon_viewing_ceremony", "\U0001F391", 0},
-  {"red_envelope", "\U0001F9E7", 11},
-  {"ribbon", "\U0001F380", 0},
-  {"wrapped_gift", "\U0001F381", 0},
-  {"reminder_ribbon", "\U0001F397", 0},
-  {"admission_tickets", "\U0001F39F", 0},
-  {"ticket", "\U0001F3AB", 0},
-  {"military_medal", "\U0001F396", 0},
-  {"trophy", "\U0001F3C6", 0},
-  {"sports_medal", "\U0001F3C5", 1},
-  {"1st_place_medal", "\U0001F947", 3},
-  {"2nd_place_medal", "\U0001F948", 3},
-  {"3rd_place_medal", "\U0001F949", 3},
-  {"soccer_ball", "\U000026BD", 0},
-  {"baseball", "\U000026BE", 0},
-  {"softball", "\U0001F94E", 11},
-  {"basketball", "\U0001F3C0", 0},
-  {"volleyball", "\U0001F3D0", 1},
-  {"american_football", "\U0001F3C8", 0},
-  {"rugby_football", "\U0001F3C9", 1},
-  {"tennis", "\U0001F3BE", 0},
-  {"flying_disc", "\U0001F94F", 11},
-  {"bowling", "\U0001F3B3", 0},
-  {"cricket_game", "\U0001F3CF", 1},
-  {"field_hockey", "\U0001F3D1", 1},
-  {"ice_hockey", "\U0001F3D2", 1},
-  {"lacrosse", "\U0001F94D", 11},
-  {"ping_pong", "\U0001F3D3", 1},
-  {"badminton", "\U0001F3F8", 1},
-  {"boxing_glove", "\U0001F94A", 3},
-  {"martial_arts_uniform", "\U0001F94B", 3},
-  {"goal_net", "\U0001F945", 3},
-  {"flag_in_hole", "\U000026F3", 0},
-  {"ice_skate", "\U000026F8", 0},
-  {"fishing_pole", "\U0001F3A3", 0},
-  {"diving_mask", "\U0001F93F", 12},
-  {"running_shirt", "\U0001F3BD", 0},
-  {"skis", "\U0001F3BF", 0},
-  {"sled", "\U0001F6F7", 5},
-  {"curling_stone", "\U0001F94C", 5},
-  {"bullseye", "\U0001F3AF", 0},
-  {"yo_yo", "\U0001FA80", 12},
-  {"kite", "\U0001FA81", 12},
-  {"pool_8_ball", "\U0001F3B1", 0},
-  {"crystal_ball", "\U0001F52E", 0},
-  {"magic_wand", "\U0001FA84", 13},
-  {"nazar_amulet", "\U0001F9FF", 11},
-  {"hamsa", "\U0001FAAC", 14},
-  {"video_game", "\U0001F3AE", 0},
-  {"joystick", "\U0001F579", 0},
-  {"slot_machine", "\U0001F3B0", 0},
-  {"game_die", "\U0001F3B2", 0},
-  {"puzzle_piece", "\U0001F9E9", 11},
-  {"teddy_bear", "\U0001F9F8", 11},
-  {"piñata", "\U0001FA85", 13},
-  {"mirror_ball", "\U0001FAA9", 14},
-  {"nesting_dolls", "\U0001FA86", 13},
-  {"spade_suit", "\U00002660", 0},
-  {"heart_suit", "\U00002665", 0},
-  {"diamond_suit", "\U00002666", 0},
-  {"club_suit", "\U00002663", 0},
-  {"chess_pawn", "\U0000265F", 11},
-  {"joker", "\U0001F0CF", 0},
-  {"mahjong_red_dragon", "\U0001F004", 0},
-  {"flower_playing_cards", "\U0001F3B4", 0},
-  {"performing_arts", "\U0001F3AD", 0},
-  {"framed_picture", "\U0001F5BC", 0},
-  {"artist_palette", "\U0001F3A8", 0},
-  {"thread", "\U0001F9F5", 11},
-  {"sewing_needle", "\U0001FAA1", 13},
-  {"yarn", "\U0001F9F6", 11},
-  {"knot", "\U0001FAA2", 13},
-  {"glasses", "\U0001F453", 0},
-  {"sunglasses", "\U0001F576", 0},
-  {"goggles", "\U0001F97D", 11},
-  {"lab_coat", "\U0001F97C", 11},
-  {"safety_vest", "\U0001F9BA", 12},
-  {"necktie", "\U0001F454", 0},
-  {"t_shirt", "\U0001F455", 0},
-  {"jeans", "\U0001F456", 0},
-  {"scarf", "\U0001F9E3", 5},
-  {"gloves", "\U0001F9E4", 5},
-  {"coat", "\U0001F9E5", 5},
-  {"socks", "\U0001F9E6", 5},
-  {"dress", "\U0001F457", 0},
-  {"kimono", "\U0001F458", 0},
-  {"sari", "\U0001F97B", 12},
-  {"one_piece_swimsuit", "\U0001FA71", 12},
-  {"briefs", "\U0001FA72", 12},
-  {"shorts", "\U0001FA73", 12},
-  {"bikini", "\U0001F459", 0},
-  {"woman’s_clothes", "\U0001F45A", 0},
-  {"purse", "\U0001F45B", 0},
-  {"handbag", "\U0001F45C", 0},
-  {"clutch_bag", "\U0001F45D", 0},
-  {"shopping_bags", "\U0001F6CD", 0},
-  {"backpack", "\U0001F392", 0},
-  {"thong_sandal", "\U0001FA74", 13},
-  {"man’s_shoe", "\U0001F45E", 0},
-  {"running_shoe", "\U0001F45F", 0},
-  {"hiking_boot", "\U0001F97E", 11},
-  {"flat_shoe", "\U0001F97F", 11},
-  {"high_heeled_shoe", "\U0001F460", 0},
-  {"woman’s_sandal", "\U0001F461", 0},
-  {"ballet_shoes", "\U0001FA70", 12},
-  {"woman’s_boot", "\U0001F462", 0},
-  {"crown", "\U0001F451", 0},
-  {"woman’s_hat", "\U0001F452", 0},
-  {"top_hat", "\U0001F3A9", 0},
-  {"graduation_cap", "\U0001F393", 0},
-  {"billed_cap", "\U0001F9E2", 5},
-  {"military_helmet", "\U0001FA96", 13},
-  {"rescue_worker’s_helmet", "\U000026D1", 0},
-  {"prayer_beads", "\U0001F4FF", 1},
-  {"lipstick", "\U0001F484", 0},
-  {"ring", "\U0001F48D", 0},
-  {"gem_stone", "\U0001F48E", 0},
-  {"muted_speaker", "\U0001F507", 1},
-  {"speaker_low_volume", "\U0001F508", 0},
-  {"speaker_medium_volume", "\U0001F509", 1},
-  {"speaker_high_volume", "\U0001F50A", 0},
-  {"loudspeaker", "\U0001F4E2", 0},
-  {"megaphone", "\U0001F4E3", 0},
-  {"postal_horn", "\U0001F4EF", 1},
-  {"bell", "\U0001F514", 0},
-  {"bell_with_slash", "\U0001F515", 1},
-  {"musical_score", "\U0001F3BC", 0},
-  {"musical_note", "\U0001F3B5", 0},
-  {"musical_notes", "\U0001F3B6", 0},
-  {"studio_microphone", "\U0001F399", 0},
-  {"level_slider", "\U0001F39A", 0},
-  {"control_knobs", "\U0001F39B", 0},
-  {"microphone", "\U0001F3A4", 0},
-  {"headphone", "\U0001F3A7", 0},
-  {"radio", "\U0001F4FB", 0},
-  {"saxophone", "\U0001F3B7", 0},
-  {"accordion", "\U0001FA97", 13},
-  {"guitar", "\U0001F3B8", 0},
-  {"musical_keyboard", "\U0001F3B9", 0},
-  {"trumpet", "\U0001F3BA", 0},
-  {"violin", "\U0001F3BB", 0},
-  {"banjo", "\U0001FA95", 12},
-  {"drum", "\U0001F941", 3},
-  {"long_drum", "\U0001FA98", 13},
-  {"mobile_phone", "\U0001F4F1", 0},
-  {"mobile_phone_with_arrow", "\U0001F4F2", 0},
-  {"telephone", "\U0000260E", 0},
-  {"telephone_receiver", "\U0001F4DE", 0},
-  {"pager", "\U0001F4DF", 0},
-  {"fax_machine", "\U0001F4E0", 0},
-  {"battery", "\U0001F50B", 0},
-  {"low_battery", "\U0001FAAB", 14},
-  {"electric_plug", "\U0001F50C", 0},
-  {"laptop", "\U0001F4BB", 0},
-  {"desktop_computer", "\U0001F5A5", 0},
-  {"printer", "\U0001F5A8", 0},
-  {"keyboard", "\U00002328", 1},
-  {"computer_mouse", "\U0001F5B1", 0},
-  {"trackball", "\U0001F5B2", 0},
-  {"computer_disk", "\U0001F4BD", 0},
-  {"floppy_disk", "\U0001F4BE", 0},
-  {"optical_disk", "\U0001F4BF", 0},
-  {"dvd", "\U0001F4C0", 0},
-  {"abacus", "\U0001F9EE", 11},
-  {"movie_camera", "\U0001F3A5", 0},
-  {"film_frames", "\U0001F39E", 0},
-  {"film_projector", "\U0001F4FD", 0},
-  {"clapper_board", "\U0001F3AC", 0},
-  {"television", "\U0001F4FA", 0},
-  {"camera", "\U0001F4F7", 0},
-  {"camera_with_flash", "\U0001F4F8", 1},
-  {"video_camera", "\U0001F4F9", 0},
-  {"videocassette", "\U0001F4FC", 0},
-  {"magnifying_glass_tilted_left", "\U0001F50D", 0},
-  {"magnifying_glass_tilted_right", "\U0001F50E", 0},
-  {"candle", "\U0001F56F", 0},
-  {"light_bulb", "\U0001F4A1", 0},
-  {"flashlight", "\U0001F526", 0},
-  {"red_paper_lantern", "\U0001F3EE", 0},
-  {"diya_lamp", "\U0001FA94", 12},
-  {"notebook_with_decorative_cover", "\U0001F4D4", 0},
-  {"closed_book", "\U0001F4D5", 0},
-  {"open_book", "\U0001F4D6", 0},
-  {"green_book", "\U0001F4D7", 0},
-  {"blue_book", "\U0001F4D8", 0},
-  {"orange_book", "\U0001F4D9", 0},
-  {"books", "\U0001F4DA", 0},
-  {"notebook", "\U0001F4D3", 0},
-  {"ledger", "\U0001F4D2", 0},
-  {"page_with_curl", "\U0001F4C3", 0},
-  {"scroll", "\U0001F4DC", 0},
-  {"page_facing_up", "\U0001F4C4", 0},
-  {"newspaper", "\U0001F4F0", 0},
-  {"rolled_up_newspaper", "\U0001F5DE", 0},
-  {"bookmark_tabs", "\U0001F4D1", 0},
-  {"bookmark", "\U0001F516", 0},
-  {"label", "\U0001F3F7", 0},
-  {"money_bag", "\U0001F4B0", 0},
-  {"coin", "\U0001FA99", 13},
-  {"yen_banknote", "\U0001F4B4", 0},
-  {"dollar_banknote", "\U0001F4B5", 0},
-  {"euro_banknote", "\U0001F4B6", 1},
-  {"pound_banknote", "\U0001F4B7", 1},
-  {"money_with_wings", "\U0001F4B8", 0},
-  {"credit_card", "\U0001F4B3", 0},
-  {"receipt", "\U0001F9FE", 11},
-  {"chart_increasing_with_yen", "\U0001F4B9", 0},
-  {"envelope", "\U00002709", 0},
-  {"e_mail", "\U0001F4E7", 0},
-  {"incoming_envelope", "\U0001F4E8", 0},
-  {"envelope_with_arrow", "\U0001F4E9", 0},
-  {"outbox_tray", "\U0001F4E4", 0},
-  {"inbox_tray", "\U0001F4E5", 0},
-  {"package", "\U0001F4E6", 0},
-  {"closed_mailbox_with_raised_flag", "\U0001F4EB", 0},
-  {"closed_mailbox_with_lowered_flag", "\U0001F4EA", 0},
-  {"open_mailbox_with_raised_flag", "\U0001F4EC", 0},
-  {"open_mailbox_with_lowered_flag", "\U0001F4ED", 0},
-  {"postbox", "\U0001F4EE", 0},
-  {"ballot_box_with_ballot", "\U0001F5F3", 0},
-  {"pencil", "\U0000270F", 0},
-  {"black_nib", "\U00002712", 0},
-  {"fountain_pen", "\U0001F58B", 0},
-  {"pen", "\U0001F58A", 0},
-  {"paintbrush", "\U0001F58C", 0},
-  {"crayon", "\U0001F58D", 0},
-  {"memo", "\U0001F4DD", 0},
-  {"briefcase", "\U0001F4BC", 0},
-  {"file_folder", "\U0001F4C1", 0},
-  {"open_file_folder", "\U0001F4C2", 0},
-  {"card_index_dividers", "\U0001F5C2", 0},
-  {"calendar", "\U0001F4C5", 0},
-  {"tear_off_calendar", "\U0001F4C6", 0},
-  {"spiral_notepad", "\U0001F5D2", 0},
-  {"spiral_calendar", "\U0001F5D3", 0},
-  {"card_index", "\U0001F4C7", 0},
-  {"chart_increasing", "\U0001F4C8", 0},
-  {"chart_decreasing", "\U0001F4C9", 0},
-  {"bar_chart", "\U0001F4CA", 0},
-  {"clipboard", "\U0001F4CB", 0},
-  {"pushpin", "\U0001F4CC", 0},
-  {"round_pushpin", "\U0001F4CD", 0},
-  {"paperclip", "\U0001F4CE", 0},
-  {"linked_paperclips", "\U0001F587", 0},
-  {"straight_ruler", "\U0001F4CF", 0},
-  {"triangular_ruler", "\U0001F4D0", 0},
-  {"scissors", "\U00002702", 0},
-  {"card_file_box", "\U0001F5C3", 0},
-  {"file_cabinet", "\U0001F5C4", 0},
-  {"wastebasket", "\U0001F5D1", 0},
-  {"locked", "\U0001F512", 0},
-  {"unlocked", "\U0001F513", 0},
-  {"locked_with_pen", "\U0001F50F", 0},
-  {"locked_with_key", "\U0001F510", 0},
-  {"key", "\U0001F511", 0},
-  {"old_key", "\U0001F5DD", 0},
-  {"hammer", "\U0001F528", 0},
-  {"axe", "\U0001FA93", 12},
-  {"pick", "\U000026CF", 0},
-  {"hammer_and_pick", "\U00002692", 1},
-  {"hammer_and_wrench", "\U0001F6E0", 0},
-  {"dagger", "\U0001F5E1", 0},
-  {"crossed_swords", "\U00002694", 1},
-  {"water_pistol", "\U0001F52B", 0},
-  {"boomerang", "\U0001FA83", 13},
-  {"bow_and_arrow", "\U0001F3F9", 1},
-  {"shield", "\U0001F6E1", 0},
-  {"carpentry_saw", "\U0001FA9A", 13},
-  {"wrench", "\U0001F527", 0},
-  {"screwdriver", "\U0001FA9B", 13},
-  {"nut_and_bolt", "\U0001F529", 0},
-  {"gear", "\U00002699", 1},
-  {"clamp", "\U0001F5DC", 0},
-  {"balance_scale", "\U00002696", 1},
-  {"white_cane", "\U0001F9AF", 12},
-  {"link", "\U0001F517", 0},
-  {"chains", "\U000026D3", 0},
-  {"hook", "\U0001FA9D", 13},
-  {"toolbox", "\U0001F9F0", 11},
-  {"magnet", "\U0001F9F2", 11},
-  {"ladder", "\U0001FA9C", 13},
-  {"alembic", "\U00002697", 1},
-  {"test_tube", "\U0001F9EA", 11},
-  {"petri_dish", "\U0001F9EB", 11},
-  {"dna", "\U0001F9EC", 11},
-  {"microscope", "\U0001F52C", 1},
-  {"telescope", "\U0001F52D", 1},
-  {"satellite_antenna", "\U0001F4E1", 0},
-  {"syringe", "\U0001F489", 0},
-  {"drop_of_blood", "\U0001FA78", 12},
-  {"pill", "\U0001F48A", 0},
-  {"adhesive_bandage", "\U0001FA79", 12},
-  {"crutch", "\U0001FA7C", 14},
-  {"stethoscope", "\U0001FA7A", 12},
-  {"x_ray", "\U0001FA7B", 14},
-  {"door", "\U0001F6AA", 0},
-  {"elevator", "\U0001F6D7", 13},
-  {"mirror", "\U0001FA9E", 13},
-  {"window", "\U0001FA9F", 13},
-  {"bed", "\U0001F6CF", 0},
-  {"couch_and_lamp", "\U0001F6CB", 0},
-  {"chair", "\U0001FA91", 12},
-  {"toilet", "\U0001F6BD", 0},
-  {"plunger", "\U0001FAA0", 13},
-  {"shower", "\U0001F6BF", 1},
-  {"bathtub", "\U0001F6C1", 1},
-  {"mouse_trap", "\U0001FAA4", 13},
-  {"razor", "\U0001FA92", 12},
-  {"lotion_bottle", "\U0001F9F4", 11},
-  {"safety_pin", "\U0001F9F7", 11},
-  {"broom", "\U0001F9F9", 11},
-  {"basket", "\U0001F9FA", 11},
-  {"roll_of_paper", "\U0001F9FB", 11},
-  {"bucket", "\U0001FAA3", 13},
-  {"soap", "\U0001F9FC", 11},
-  {"bubbles", "\U0001FAE7", 14},
-  {"toothbrush", "\U0001FAA5", 13},
-  {"sponge", "\U0001F9FD", 11},
-  {"fire_extinguisher", "\U0001F9EF", 11},
-  {"shopping_cart", "\U0001F6D2", 3},
-  {"cigarette", "\U0001F6AC", 0},
-  {"coffin", "\U000026B0", 1},
-  {"headstone", "\U0001FAA6", 13},
-  {"funeral_urn", "\U000026B1", 1},
-  {"moai", "\U0001F5FF", 0},
-  {"placard", "\U0001FAA7", 13},
-  {"identification_card", "\U0001FAAA", 14},
-  {"atm_sign", "\U0001F3E7", 0},
-  {"litter_in_bin_sign", "\U0001F6AE", 1},
-  {"potable_water", "\U0001F6B0", 1},
-  {"wheelchair_symbol", "\U0000267F", 0},
-  {"men’s_room", "\U0001F6B9", 0},
-  {"women’s_room", "\U0001F6BA", 0},
-  {"restroom", "\U0001F6BB", 0},
-  {"baby_symbol", "\U0001F6BC", 0},
-  {"water_closet", "\U0001F6BE", 0},
-  {"passport_control", "\U0001F6C2", 1},
-  {"customs", "\U0001F6C3", 1},
-  {"baggage_claim", "\U0001F6C4", 1},
-  {"left_luggage", "\U0001F6C5", 1},
-  {"warning", "\U000026A0", 0},
-  {"children_crossing", "\U0001F6B8", 1},
-  {"no_entry", "\U000026D4", 0},
-  {"prohibited", "\U0001F6AB", 0},
-  {"no_bicycles", "\U0001F6B3", 1},
-  {"no_smoking", "\U0001F6AD", 0},
-  {"no_littering", "\U0001F6AF", 1},
-  {"non_potable_water", "\U0001F6B1", 1},
-  {"no_pedestrians", "\U0001F6B7", 1},
-  {"no_mobile_phones", "\U0001F4F5", 1},
-  {"no_one_under_eighteen", "\U0001F51E", 0},
-  {"radioactive", "\U00002622", 1},
-  {"biohazard", "\U00002623", 1},
-  {"up_arrow", "\U00002B06", 0},
-  {"up_right_arrow", "\U00002197", 0},
-  {"right_arrow", "\U000027A1", 0},
-  {"down_right_arrow", "\U00002198", 0},
-  {"down_arrow", "\U00002B07", 0},
-  {"down_left_arrow", "\U00002199", 0},
-  {"left_arrow", "\U00002B05", 0},
-  {"up_left_arrow", "\U00002196", 0},
-  {"up_down_arrow", "\U00002195", 0},
-  {"left_right_arrow", "\U00002194", 0},
-  {"right_arrow_curving_left", "\U000021A9", 0},
-  {"left_arrow_curving_right", "\U000021AA", 0},
-  {"right_arrow_curving_up", "\U00002934", 0},
-  {"right_arrow_curving_down", "\U00002935", 0},
-  {"clockwise_vertical_arrows", "\U0001F503", 0},
-  {"counterclockwise_arrows_button", "\U0001F504", 1},
-  {"back_arrow", "\U0001F519", 0},
-  {"end_arrow", "\U0001F51A", 0},
-  {"on!_arrow", "\U0001F51B", 0},
-  {"soon_arrow", "\U0001F51C", 0},
-  {"top_arrow", "\U0001F51D", 0},
-  {"place_of_worship", "\U0001F6D0", 1},
-  {"atom_symbol", "\U0000269B", 1},
-  {"om", "\U0001F549", 0},
-  {"star_of_david", "\U00002721", 0},
-  {"wheel_of_dharma", "\U00002638", 0},
-  {"yin_yang", "\U0000262F", 0},
-  {"latin_cross", "\U0000271D", 0},
-  {"orthodox_cross", "\U00002626", 1},
-  {"star_and_crescent", "\U0000262A", 0},
-  {"peace_symbol", "\U0000262E", 1},
-  {"menorah", "\U0001F54E", 1},
-  {"dotted_six_pointed_star", "\U0001F52F", 0},
-  {"aries", "\U00002648", 0},
-  {"taurus", "\U00002649", 0},
-  {"gemini", "\U0000264A", 0},
-  {"cancer", "\U0000264B", 0},
-  {"leo", "\U0000264C", 0},
-  {"virgo", "\U0000264D", 0},
-  {"libra", "\U0000264E", 0},
-  {"scorpio", "\U0000264F", 0},
-  {"sagittarius", "\U00002650", 0},
-  {"capricorn", "\U00002651", 0},
-  {"aquarius", "\U00002652", 0},
-  {"pisces", "\U00002653", 0},
-  {"ophiuchus", "\U000026CE", 0},
-  {"shuffle_tracks_button", "\U0001F500", 1},
-  {"repeat_button", "\U0001F501", 1},
-  {"repeat_single_button", "\U0001F502", 1},
-  {"play_button", "\U000025B6", 0},
-  {"fast_forward_button", "\U000023E9", 0},
-  {"next_track_button", "\U000023ED", 0},
-  {"play_or_pause_button", "\U000023EF", 1},
-  {"reverse_button", "\U000025C0", 0},
-  {"fast_reverse_button", "\U000023EA", 0},
-  {"last_track_button", "\U000023EE", 0},
-  {"upwards_button", "\U0001F53C", 0},
-  {"fast_up_button", "\U000023EB", 0},
-  {"downwards_button", "\U0001F53D", 0},
-  {"fast_down_button", "\U000023EC", 0},
-  {"pause_button", "\U000023F8", 0},
-  {"stop_button", "\U000023F9", 0},
-  {"record_button", "\U000023FA", 0},
-  {"eject_button", "\U000023CF", 1},
-  {"cinema", "\U0001F3A6", 0},
-  {"dim_button", "\U0001F505", 1},
-  {"bright_button", "\U0001F506", 1},
-  {"antenna_bars", "\U0001F4F6", 0},
-  {"vibration_mode", "\U0001F4F3", 0},
-  {"mobile_phone_off", "\U0001F4F4", 0},
-  {"female_sign", "\U00002640", 4},
-  {"male_sign", "\U00002642", 4},
-  {"transgender_symbol", "\U000026A7", 13},
-  {"multiply", "\U00002716", 0},
-  {"plus", "\U00002795", 0},
-  {"minus", "\U00002796", 0},
-  {"divide", "\U00002797", 0},
-  {"heavy_equals_sign", "\U0001F7F0", 14},
-  {"infinity", "\U0000267E", 11},
-  {"double_exclamation_mark", "\U0000203C", 0},
-  {"exclamation_question_mark", "\U00002049", 0},
-  {"red_question_mark", "\U00002753", 0},
-  {"white_question_mark", "\U00002754", 0},
-  {"white_exclamation_mark", "\U00002755", 0},
-  {"red_exclamation_mark", "\U00002757", 0},
-  {"wavy_dash", "\U00003030", 0},
-  {"currency_exchange", "\U0001F4B1", 0},
-  {"heavy_dollar_sign", "\U0001F4B2", 0},
-  {"medical_symbol", "\U00002695", 4},
-  {"recycling_symbol", "\U0000267B", 0},
-  {"fleur_de_lis", "\U0000269C", 1},
-  {"trident_emblem", "\U0001F531", 0},
-  {"name_badge", "\U0001F4DB", 0},
-  {"japanese_symbol_for_beginner", "\U0001F530", 0},
-  {"hollow_red_circle", "\U00002B55", 0},
-  {"check_mark_button", "\U00002705", 0},
-  {"check_box_with_check", "\U00002611", 0},
-  {"check_mark", "\U00002714", 0},
-  {"cross_mark", "\U0000274C", 0},
-  {"cross_mark_button", "\U0000274E", 0},
-  {"curly_loop", "\U000027B0", 0},
-  {"double_curly_loop", "\U000027BF", 1},
-  {"part_alternation_mark", "\U0000303D", 0},
-  {"eight_spoked_asterisk", "\U00002733", 0},
-  {"eight_pointed_star", "\U00002734", 0},
-  {"sparkle", "\U00002747", 0},
-  {"copyright", "\U000000A9", 0},
-  {"registered", "\U000000AE", 0},
-  {"trade_mark", "\U00002122", 0},
-  {"keycap_#", "\U00000023\U000020E3", 0},
-  {"keycap_*", "\U0000002A\U000020E3", 2},
-  {"keycap_0", "\U00000030\U000020E3", 0},
-  {"keycap_1", "\U00000031\U000020E3", 0},
-  {"keycap_2", "\U00000032\U000020E3", 0},
-  {"keycap_3", "\U00000033\U000020E3", 0},
-  {"keycap_4", "\U00000034\U000020E3", 0},
-  {"keycap_5", "\U00000035\U000020E3", 0},
-  {"keycap_6", "\U00000036\U000020E3", 0},
-  {"keycap_7", "\U00000037\U000020E3", 0},
-  {"keycap_8", "\U00000038\U000020E3", 0},
-  {"keycap_9", "\U00000039\U000020E3", 0},
-  {"keycap_10", "\U0001F51F", 0},
-  {"input_latin_uppercase", "\U0001F520", 0},
-  {"input_latin_lowercase", "\U0001F521", 0},
-  {"input_numbers", "\U0001F522", 0},
-  {"input_symbols", "\U0001F523", 0},
-  {"input_latin_letters", "\U0001F524", 0},
-  {"a_button_blood_type", "\U0001F170", 0},
-  {"ab_button_blood_type", "\U0001F18E", 0},
-  {"b_button_blood_type", "\U0001F171", 0},
-  {"cl_button", "\U0001F191", 0},
-  {"cool_button", "\U0001F192", 0},
-  {"free_button", "\U0001F193", 0},
-  {"information", "\U00002139", 0},
-  {"id_button", "\U0001F194", 0},
-  {"circled_m", "\U000024C2", 0},
-  {"new_button", "\U0001F195", 0},
-  {"ng_button", "\U0001F196", 0},
-  {"o_button_blood_type", "\U0001F17E", 0},
-  {"ok_button", "\U0001F197", 0},
-  {"p_button", "\U0001F17F", 0},
-  {"sos_button", "\U0001F198", 0},
-  {"up!_button", "\U0001F199", 0},
-  {"vs_button", "\U0001F19A", 0},
-  {"japanese_here_button", "\U0001F201", 0},
-  {"japanese_service_charge_button", "\U0001F202", 0},
-  {"japanese_monthly_amount_button", "\U0001F237", 0},
-  {"japanese_not_free_of_charge_button", "\U0001F236", 0},
-  {"japanese_reserved_button", "\U0001F22F", 0},
-  {"japanese_bargain_button", "\U0001F250", 0},
-  {"japanese_discount_button", "\U0001F239", 0},
-  {"japanese_free_of_charge_button", "\U0001F21A", 0},
-  {"japanese_prohibited_button", "\U0001F232", 0},
-  {"japanese_acceptable_button", "\U0001F251", 0},
-  {"japanese_application_button", "\U0001F238", 0},
-  {"japanese_passing_grade_button", "\U0001F234", 0},
-  {"japanese_vacancy_button", "\U0001F233", 0},
-  {"japanese_congratulations_button", "\U00003297", 0},
-  {"japanese_secret_button", "\U00003299", 0},
-  {"japanese_open_for_business_button", "\U0001F23A", 0},
-  {"japanese_no_vacancy_button", "\U0001F235", 0},
-  {"red_circle", "\U0001F534", 0},
-  {"orange_circle", "\U0001F7E0", 12},
-  {"yellow_circle", "\U0001F7E1", 12},
-  {"green_circle", "\U0001F7E2", 12},
-  {"blue_circle", "\U0001F535", 0},
-  {"purple_circle", "\U0001F7E3", 12},
-  {"brown_circle", "\U0001F7E4", 12},
-  {"black_circle", "\U000026AB", 0},
-  {"white_circle", "\U000026AA", 0},
-  {"red_square", "\U0001F7E5", 12},
-  {"orange_square", "\U0001F7E7", 12},
-  {"yellow_square", "\U0001F7E8", 12},
-  {"green_square", "\U0001F7E9", 12},
-  {"blue_square", "\U0001F7E6", 12},
-  {"purple_square", "\U0001F7EA", 12},
-  {"brown_square", "\U0001F7EB", 12},
-  {"black_large_square", "\U00002B1B", 0},
-  {"white_large_square", "\U00002B1C", 0},
-  {"black_medium_square", "\U000025FC", 0},
-  {"white_medium_square", "\U000025FB", 0},
-  {"black_medium_small_square", "\U000025FE", 0},
-  {"white_medium_small_square", "\U000025FD", 0},
-  {"black_small_square", "\U000025AA", 0},
-  {"white_small_square", "\U000025AB", 0},
-  {"large_orange_diamond", "\U0001F536", 0},
-  {"large_blue_diamond", "\U0001F537", 0},
-  {"small_orange_diamond", "\U0001F538", 0},
-  {"small_blue_diamond", "\U0001F539", 0},
-  {"red_triangle_pointed_up", "\U0001F53A", 0},
-  {"red_triangle_pointed_down", "\U0001F53B", 0},
-  {"diamond_with_a_dot", "\U0001F4A0", 0},
-  {"radio_button", "\U0001F518", 0},
-  {"white_square_button", "\U0001F533", 0},
-  {"black_square_button", "\U0001F532", 0},
-  {"chequered_flag", "\U0001F3C1", 0},
-  {"triangular_flag", "\U0001F6A9", 0},
-  {"crossed_flags", "\U0001F38C", 0},
-  {"black_flag", "\U0001F3F4", 1},
-  {"white_flag", "\U0001F3F3", 0},
-  {"rainbow_flag", "\U0001F3F3\U0000FE0F\U0000200D\U0001F308", 4},
-  {"transgender_flag", "\U0001F3F3\U0000FE0F\U0000200D\U000026A7\U0000FE0F", 13},
-  {"pirate_flag", "\U0001F3F4\U0000200D\U00002620\U0000FE0F", 11},
-  {"flag_ascension_island", "\U0001F1E6\U0001F1E8", 2},
-  {"flag_andorra", "\U0001F1E6\U0001F1E9", 2},
-  {"flag_united_arab_emirates", "\U0001F1E6\U0001F1EA", 2},
-  {"flag_afghanistan", "\U0001F1E6\U0001F1EB", 2},
-  {"flag_antigua_&_barbuda", "\U0001F1E6\U0001F1EC", 2},
-  {"flag_anguilla", "\U0001F1E6\U0001F1EE", 2},
-  {"flag_albania", "\U0001F1E6\U0001F1F1", 2},
-  {"flag_armenia", "\U0001F1E6\U0001F1F2", 2},
-  {"flag_angola", "\U0001F1E6\U0001F1F4", 2},
-  {"flag_antarctica", "\U0001F1E6\U0001F1F6", 2},
-  {"flag_argentina", "\U0001F1E6\U0001F1F7", 2},
-  {"flag_american_samoa", "\U0001F1E6\U0001F1F8", 2},
-  {"flag_austria", "\U0001F1E6\U0001F1F9", 2},
-  {"flag_australia", "\U0001F1E6\U0001F1FA", 2},
-  {"flag_aruba", "\U0001F1E6\U0001F1FC", 2},
-  {"flag_åland_islands", "\U0001F1E6\U0001F1FD", 2},
-  {"flag_azerbaijan", "\U0001F1E6\U0001F1FF", 2},
-  {"flag_bosnia_&_herzegovina", "\U0001F1E7\U0001F1E6", 2},
-  {"flag_barbados", "\U0001F1E7\U0001F1E7", 2},
-  {"flag_bangladesh", "\U0001F1E7\U0001F1E9", 2},
-  {"flag_belgium", "\U0001F1E7\U0001F1EA", 2},
-  {"flag_burkina_faso", "\U0001F1E7\U0001F1EB", 2},
-  {"flag_bulgaria", "\U0001F1E7\U0001F1EC", 2},
-  {"flag_bahrain", "\U0001F1E7\U0001F1ED", 2},
-  {"flag_burundi", "\U0001F1E7\U0001F1EE", 2},
-  {"flag_benin", "\U0001F1E7\U0001F1EF", 2},
-  {"flag_st_barthélemy", "\U0001F1E7\U0001F1F1", 2},
-  {"flag_bermuda", "\U0001F1E7\U0001F1F2", 2},
-  {"flag_brunei", "\U0001F1E7\U0001F1F3", 2},
-  {"flag_bolivia", "\U0001F1E7\U0001F1F4", 2},
-  {"flag_caribbean_netherlands", "\U0001F1E7\U0001F1F6", 2},
-  {"flag_brazil", "\U0001F1E7\U0001F1F7", 2},
-  {"flag_bahamas", "\U0001F1E7\U0001F1F8", 2},
-  {"flag_bhutan", "\U0001F1E7\U0001F1F9", 2},
-  {"flag_bouvet_island", "\U0001F1E7\U0001F1FB", 2},
-  {"flag_botswana", "\U0001F1E7\U0001F1FC", 2},
-  {"flag_belarus", "\U0001F1E7\U0001F1FE", 2},
-  {"flag_belize", "\U0001F1E7\U0001F1FF", 2},
-  {"flag_canada", "\U0001F1E8\U0001F1E6", 2},
-  {"flag_cocos_keeling_islands", "\U0001F1E8\U0001F1E8", 2},
-  {"flag_congo_kinshasa", "\U0001F1E8\U0001F1E9", 2},
-  {"flag_central_african_republic", "\U0001F1E8\U0001F1EB", 2},
-  {"flag_congo_brazzaville", "\U0001F1E8\U0001F1EC", 2},
-  {"flag_switzerland", "\U0001F1E8\U0001F1ED", 2},
-  {"flag_côte_d’ivoire", "\U0001F1E8\U0001F1EE", 2},
-  {"flag_cook_islands", "\U0001F1E8\U0001F1F0", 2},
-  {"flag_chile", "\U0001F1E8\U0001F1F1", 2},
-  {"flag_cameroon", "\U0001F1E8\U0001F1F2", 2},
-  {"flag_china", "\U0001F1E8\U0001F1F3", 0},
-  {"flag_colombia", "\U0001F1E8\U0001F1F4", 2},
-  {"flag_clipperton_island", "\U0001F1E8\U0001F1F5", 2},
-  {"flag_costa_rica", "\U0001F1E8\U0001F1F7", 2},
-  {"flag_cuba", "\U0001F1E8\U0001F1FA", 2},
-  {"flag_cape_verde", "\U0001F1E8\U0001F1FB", 2},
-  {"flag_curaçao", "\U0001F1E8\U0001F1FC", 2},
-  {"flag_christmas_island", "\U0001F1E8\U0001F1FD", 2},
-  {"flag_cyprus", "\U0001F1E8\U0001F1FE", 2},
-  {"flag_czechia", "\U0001F1E8\U0001F1FF", 2},
-  {"flag_germany", "\U0001F1E9\U0001F1EA", 0},
-  {"flag_diego_garcia", "\U0001F1E9\U0001F1EC", 2},
-  {"flag_djibouti", "\U0001F1E9\U0001F1EF", 2},
-  {"flag_denmark", "\U0001F1E9\U0001F1F0", 2},
-  {"flag_dominica", "\U0001F1E9\U0001F1F2", 2},
-  {"flag_dominican_republic", "\U0001F1E9\U0001F1F4", 2},
-  {"flag_algeria", "\U0001F1E9\U0001F1FF", 2},
-  {"flag_ceuta_&_melilla", "\U0001F1EA\U0001F1E6", 2},
-  {"flag_ecuador", "\U0001F1EA\U0001F1E8", 2},
-  {"flag_estonia", "\U0001F1EA\U0001F1EA", 2},
-  {"flag_egypt", "\U0001F1EA\U0001F1EC", 2},
-  {"flag_western_sahara", "\U0001F1EA\U0001F1ED", 2},
-  {"flag_eritrea", "\U0001F1EA\U0001F1F7", 2},
-  {"flag_spain", "\U0001F1EA\U0001F1F8", 0},
-  {"flag_ethiopia", "\U0001F1EA\U0001F1F9", 2},
-  {"flag_european_union", "\U0001F1EA\U0001F1FA", 2},
-  {"flag_finland", "\U0001F1EB\U0001F1EE", 2},
-  {"flag_fiji", "\U0001F1EB\U0001F1EF", 2},
-  {"flag_falkland_islands", "\U0001F1EB\U0001F1F0", 2},
-  {"flag_micronesia", "\U0001F1EB\U0001F1F2", 2},
-  {"flag_faroe_islands", "\U0001F1EB\U0001F1F4", 2},
-  {"flag_france", "\U0001F1EB\U0001F1F7", 0},
-  {"flag_gabon", "\U0001F1EC\U0001F1E6", 2},
-  {"flag_united_kingdom", "\U0001F1EC\U0001F1E7", 0},
-  {"flag_grenada", "\U0001F1EC\U0001F1E9", 2},
-  {"flag_georgia", "\U0001F1EC\U0001F1EA", 2},
-  {"flag_french_guiana", "\U0001F1EC\U0001F1EB", 2},
-  {"flag_guernsey", "\U0001F1EC\U0001F1EC", 2},
-  {"flag_ghana", "\U0001F1EC\U0001F1ED", 2},
-  {"flag_gibraltar", "\U0001F1EC\U0001F1EE", 2},
-  {"flag_greenland", "\U0001F1EC\U0001F1F1", 2},
-  {"flag_gambia", "\U0001F1EC\U0001F1F2", 2},
-  {"flag_guinea", "\U0001F1EC\U0001F1F3", 2},
-  {"flag_guadeloupe", "\U0001F1EC\U0001F1F5", 2},
-  {"flag_equatorial_guinea", "\U0001F1EC\U0001F1F6", 2},
-  {"flag_greece", "\U0001F1EC\U0001F1F7", 2},
-  {"flag_south_georgia_&_south_sandwich_islands", "\U0001F1EC\U0001F1F8", 2},
-  {"flag_guatemala", "\U0001F1EC\U0001F1F9", 2},
-  {"flag_guam", "\U0001F1EC\U0001F1FA", 2},
-  {"flag_guinea_bissau", "\U0001F1EC\U0001F1FC", 2},
-  {"flag_guyana", "\U0001F1EC\U0001F1FE", 2},
-  {"flag_hong_kong_sar_china", "\U0001F1ED\U0001F1F0", 2},
-  {"flag_heard_&_mcdonald_islands", "\U0001F1ED\U0001F1F2", 2},
-  {"flag_honduras", "\U0001F1ED\U0001F1F3", 2},
-  {"flag_croatia", "\U0001F1ED\U0001F1F7", 2},
-  {"flag_haiti", "\U0001F1ED\U0001F1F9", 2},
-  {"flag_hungary", "\U0001F1ED\U0001F1FA", 2},
-  {"flag_canary_islands", "\U0001F1EE\U0001F1E8", 2},
-  {"flag_indonesia", "\U0001F1EE\U0001F1E9", 2},
-  {"flag_ireland", "\U0001F1EE\U0001F1EA", 2},
-  {"flag_israel", "\U0001F1EE\U0001F1F1", 2},
-  {"flag_isle_of_man", "\U0001F1EE\U0001F1F2", 2},
-  {"flag_india", "\U0001F1EE\U0001F1F3", 2},
-  {"flag_british_indian_ocean_territory", "\U0001F1EE\U0001F1F4", 2},
-  {"flag_iraq", "\U0001F1EE\U0001F1F6", 2},
-  {"flag_iran", "\U0001F1EE\U0001F1F7", 2},
-  {"flag_iceland", "\U0001F1EE\U0001F1F8", 2},
-  {"flag_italy", "\U0001F1EE\U0001F1F9", 0},
-  {"flag_jersey", "\U0001F1EF\U0001F1EA", 2},
-  {"flag_jamaica", "\U0001F1EF\U0001F1F2", 2},
-  {"flag_jordan", "\U0001F1EF\U0001F1F4", 2},
-  {"flag_japan", "\U0001F1EF\U0001F1F5", 0},
-  {"flag_kenya", "\U0001F1F0\U0001F1EA", 2},
-  {"flag_kyrgyzstan", "\U0001F1F0\U0001F1EC", 2},
-  {"flag_cambodia", "\U0001F1F0\U0001F1ED", 2},
-  {"flag_kiribati", "\U0001F1F0\U0001F1EE", 2},
-  {"flag_comoros", "\U0001F1F0\U0001F1F2", 2},
-  {"flag_st_kitts_&_nevis", "\U0001F1F0\U0001F1F3", 2},
-  {"flag_north_korea", "\U0001F1F0\U0001F1F5", 2},
-  {"flag_south_korea", "\U0001F1F0\U0001F1F7", 0},
-  {"flag_kuwait", "\U0001F1F0\U0001F1FC", 2},
-  {"flag_cayman_islands", "\U0001F1F0\U0001F1FE", 2},
-  {"flag_kazakhstan", "\U0001F1F0\U0001F1FF", 2},
-  {"flag_laos", "\U0001F1F1\U0001F1E6", 2},
-  {"flag_lebanon", "\U0001F1F1\U0001F1E7", 2},
-  {"flag_st_lucia", "\U0001F1F1\U0001F1E8", 2},
-  {"flag_liechtenstein", "\U0001F1F1\U0001F1EE", 2},
-  {"flag_sri_lanka", "\U0001F1F1\U0001F1F0", 2},
-  {"flag_liberia", "\U0001F1F1\U0001F1F7", 2},
-  {"flag_lesotho", "\U0001F1F1\U0001F1F8", 2},
-  {"flag_lithuania", "\U0001F1F1\U0001F1F9", 2},
-  {"flag_luxembourg", "\U0001F1F1\U0001F1FA", 2},
-  {"flag_latvia", "\U0001F1F1\U0001F1FB", 2},
-  {"flag_libya", "\U0001F1F1\U0001F1FE", 2},
-  {"flag_morocco", "\U0001F1F2\U0001F1E6", 2},
-  {"flag_monaco", "\U0001F1F2\U0001F1E8", 2},
-  {"flag_moldova", "\U0001F1F2\U0001F1E9", 2},
-  {"flag_montenegro", "\U0001F1F2\U0001F1EA", 2},
-  {"flag_st_martin", "\U0001F1F2\U0001F1EB", 2},
-  {"flag_madagascar", "\U0001F1F2\U0001F1EC", 2},
-  {"flag_marshall_islands", "\U0001F1F2\U0001F1ED", 2},
-  {"flag_north_macedonia", "\U0001F1F2\U0001F1F0", 2},
-  {"flag_mali", "\U0001F1F2\U0001F1F1", 2},
-  {"flag_myanmar_burma", "\U0001F1F2\U0001F1F2", 2},
-  {"flag_mongolia", "\U0001F1F2\U0001F1F3", 2},
-  {"flag_macao_sar_china", "\U0001F1F2\U0001F1F4", 2},
-  {"flag_northern_mariana_islands", "\U0001F1F2\U0001F1F5", 2},
-  {"flag_martinique", "\U0001F1F2\U0001F1F6", 2},
-  {"flag_mauritania", "\U0001F1F2\U0001F1F7", 2},
-  {"flag_montserrat", "\U0001F1F2\U0001F1F8", 2},
-  {"flag_malta", "\U0001F1F2\U0001F1F9", 2},
-  {"flag_mauritius", "\U0001F1F2\U0001F1FA", 2},
-  {"flag_maldives", "\U0001F1F2\U0001F1FB", 2},
-  {"flag_malawi", "\U0001F1F2\U0001F1FC", 2},
-  {"flag_mexico", "\U0001F1F2\U0001F1FD", 2},
-  {"flag_malaysia", "\U0001F1F2\U0001F1FE", 2},
-  {"flag_mozambique", "\U0001F1F2\U0001F1FF", 2},
-  {"flag_namibia", "\U0001F1F3\U0001F1E6", 2},
-  {"flag_new_caledonia", "\U0001F1F3\U0001F1E8", 2},
-  {"flag_niger", "\U0001F1F3\U0001F1EA", 2},
-  {"flag_norfolk_island", "\U0001F1F3\U0001F1EB", 2},
-  {"flag_nigeria", "\U0001F1F3\U0001F1EC", 2},
-  {"flag_nicaragua", "\U0001F1F3\U0001F1EE", 2},
-  {"flag_netherlands", "\U0001F1F3\U0001F1F1", 2},
-  {"flag_norway", "\U0001F1F3\U0001F1F4", 2},
-  {"flag_nepal", "\U0001F1F3\U0001F1F5", 2},
-  {"flag_nauru", "\U0001F1F3\U0001F1F7", 2},
-  {"flag_niue", "\U0001F1F3\U0001F1FA", 2},
-  {"flag_new_zealand", "\U0001F1F3\U0001F1FF", 2},
-  {"flag_oman", "\U0001F1F4\U0001F1F2", 2},
-  {"flag_panama", "\U0001F1F5\U0001F1E6", 2},
-  {"flag_peru", "\U0001F1F5\U0001F1EA", 2},
-  {"flag_french_polynesia", "\U0001F1F5\U0001F1EB", 2},
-  {"flag_papua_new_guinea", "\U0001F1F5\U0001F1EC", 2},
-  {"flag_philippines", "\U0001F1F5\U0001F1ED", 2},
-  {"flag_pakistan", "\U0001F1F5\U0001F1F0", 2},
-  {"flag_poland", "\U0001F1F5\U0001F1F1", 2},
-  {"flag_st_pierre_&_miquelon", "\U0001F1F5\U0001F1F2", 2},
-  {"flag_pitcairn_islands", "\U0001F1F5\U0001F1F3", 2},
-  {"flag_puerto_rico", "\U0001F1F5\U0001F1F7", 2},
-  {"flag_palestinian_territories", "\U0001F1F5\U0001F1F8", 2},
-  {"flag_portugal", "\U0001F1F5\U0001F1F9", 2},
-  {"flag_palau", "\U0001F1F5\U0001F1FC", 2},
-  {"flag_paraguay", "\U0001F1F5\U0001F1FE", 2},
-  {"flag_qatar", "\U0001F1F6\U0001F1E6", 2},
-  {"flag_réunion", "\U0001F1F7\U0001F1EA", 2},
-  {"flag_romania", "\U0001F1F7\U0001F1F4", 2},
-  {"flag_serbia", "\U0001F1F7\U0001F1F8", 2},
-  {"flag_russia", "\U0001F1F7\U0001F1FA", 0},
-  {"flag_rwanda", "\U0001F1F7\U0001F1FC", 2},
-  {"flag_saudi_arabia", "\U0001F1F8\U0001F1E6", 2},
-  {"flag_solomon_islands", "\U0001F1F8\U0001F1E7", 2},
-  {"flag_seychelles", "\U0001F1F8\U0001F1E8", 2},
-  {"flag_sudan", "\U0001F1F8\U0001F1E9", 2},
-  {"flag_sweden", "\U0001F1F8\U0001F1EA", 2},
-  {"flag_singapore", "\U0001F1F8\U0001F1EC", 2},
-  {"flag_st_helena", "\U0001F1F8\U0001F1ED", 2},
-  {"flag_slovenia", "\U0001F1F8\U0001F1EE", 2},
-  {"flag_svalbard_&_jan_mayen", "\U0001F1F8\U0001F1EF", 2},
-  {"flag_slovakia", "\U0001F1F8\U0001F1F0", 2},
-  {"flag_sierra_leone", "\U0001F1F8\U0001F1F1", 2},
-  {"flag_san_marino", "\U0001F1F8\U0001F1F2", 2},
-  {"flag_senegal", "\U0001F1F8\U0001F1F3", 2},
-  {"flag_somalia", "\U0001F1F8\U0001F1F4", 2},
-  {"flag_suriname", "\U0001F1F8\U0001F1F7", 2},
-  {"flag_south_sudan", "\U0001F1F8\U0001F1F8", 2},
-  {"flag_são_tomé_&_príncipe", "\U0001F1F8\U0001F1F9", 2},
-  {"flag_el_salvador", "\U0001F1F8\U0001F1FB", 2},
-  {"flag_sint_maarten", "\U0001F1F8\U0001F1FD", 2},
-  {"flag_syria", "\U0001F1F8\U0001F1FE", 2},
-  {"flag_eswatini", "\U0001F1F8\U0001F1FF", 2},
-  {"flag_tristan_da_cunha", "\U0001F1F9\U0001F1E6", 2},
-  {"flag_turks_&_caicos_islands", "\U0001F1F9\U0001F1E8", 2},
-  {"flag_chad", "\U0001F1F9\U0001F1E9", 2},
-  {"flag_french_southern_territories", "\U0001F1F9\U0001F1EB", 2},
-  {"flag_togo", "\U0001F1F9\U0001F1EC", 2},
-  {"flag_thailand", "\U0001F1F9\U0001F1ED", 2},
-  {"flag_tajikistan", "\U0001F1F9\U0001F1EF", 2},
-  {"flag_tokelau", "\U0001F1F9\U0001F1F0", 2},
-  {"flag_timor_leste", "\U0001F1F9\U0001F1F1", 2},
-  {"flag_turkmenistan", "\U0001F1F9\U0001F1F2", 2},
-  {"flag_tunisia", "\U0001F1F9\U0001F1F3", 2},
-  {"flag_tonga", "\U0001F1F9\U0001F1F4", 2},
-  {"flag_turkey", "\U0001F1F9\U0001F1F7", 2},
-  {"flag_trinidad_&_tobago", "\U0001F1F9\U0001F1F9", 2},
-  {"flag_tuvalu", "\U0001F1F9\U0001F1FB", 2},
-  {"flag_taiwan", "\U0001F1F9\U0001F1FC", 2},
-  {"flag_tanzania", "\U0001F1F9\U0001F1FF", 2},
-  {"flag_ukraine", "\U0001F1FA\U0001F1E6", 2},
-  {"flag_uganda", "\U0001F1FA\U0001F1EC", 2},
-  {"flag_us_outlying_islands", "\U0001F1FA\U0001F1F2", 2},
-  {"flag_united_nations", "\U0001F1FA\U0001F1F3", 4},
-  {"flag_united_states", "\U0001F1FA\U0001F1F8", 0},
-  {"flag_uruguay", "\U0001F1FA\U0001F1FE", 2},
-  {"flag_uzbekistan", "\U0001F1FA\U0001F1FF", 2},
-  {"flag_vatican_city", "\U0001F1FB\U0001F1E6", 2},
-  {"flag_st_vincent_&_grenadines", "\U0001F1FB\U0001F1E8", 2},
-  {"flag_venezuela", "\U0001F1FB\U0001F1EA", 2},
-  {"flag_british_virgin_islands", "\U0001F1FB\U0001F1EC", 2},
-  {"flag_us_virgin_islands", "\U0001F1FB\U0001F1EE", 2},
-  {"flag_vietnam", "\U0001F1FB\U0001F1F3", 2},
-  {"flag_vanuatu", "\U0001F1FB\U0001F1FA", 2},
-  {"flag_wallis_&_futuna", "\U0001F1FC\U0001F1EB", 2},
-  {"flag_samoa", "\U0001F1FC\U0001F1F8", 2},
-  {"flag_kosovo", "\U0001F1FD\U0001F1F0", 2},
-  {"flag_yemen", "\U0001F1FE\U0001F1EA", 2},
-  {"flag_mayotte", "\U0001F1FE\U0001F1F9", 2},
-  {"flag_south_africa", "\U0001F1FF\U0001F1E6", 2},
-  {"flag_zambia", "\U0001F1FF\U0001F1F2", 2},
-  {"flag_zimbabwe", "\U0001F1FF\U0001F1FC", 2},
-  {"flag_england", "\U0001F3F4\U000E0067\U000E0062\U000E0065\U000E006E\U000E0067\U000E007F", 5},
-  {"flag_scotland", "\U0001F3F4\U000E0067\U000E0062\U000E0073\U000E0063\U000E0074\U000E007F", 5},
-  {"flag_wales", "\U0001F3F4\U000E0067\U000E0062\U000E0077\U000E006C\U000E0073\U000E007F", 5}
-};
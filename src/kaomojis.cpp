@@ -1,6 +1,6 @@
 #include "kaomojis.hpp"
 
-const Kaomoji kaomojis[] = {
+constexpr Kaomoji kaomojis[] = {
   {"grinning", "(* ^ ω ^)"},
   {"grinning", "(≧◡≦)"},
   {"grinning_with_arms", "ヽ(o^ ^o)ﾉ"},
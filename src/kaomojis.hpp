@@ -1,11 +1,12 @@
 #pragma once
 
-#include <string>
+#include <string_view>
 
+// same as `Emoji`: views into string literals so the table needs no static initialization
 struct Kaomoji {
 public:
-  std::string name;
-  std::string text;
+  std::string_view name;
+  std::string_view text;
 
   bool operator==(const Kaomoji& other) const {
     return name == other.name;
@@ -0,0 +1,164 @@
+// packs the emoji images into prescaled atlas pages and generates emoji-atlas.hpp and emoji-atlas.qrc.
+// see the `generate-emoji-atlas` command in CMakeLists.txt
+//
+// usage: generate-emoji-atlas <emoji-images.txt> <output directory>
+// emoji-images.txt has one image per line in the order of the emoji ids (written by generate-emojis).
+// every cell of a page has the same size so the position of an emoji follows from its id and no table is needed.
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QImage>
+#include <QPainter>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 14 = status bar, 24 = emoji list, both at a device pixel ratio of 1 and 2
+const std::vector<int> CELL_SIZES = {14, 24, 28, 48};
+
+const int PAGE_COLUMNS = 16;
+const int PAGE_ROWS = 16;
+
+bool readEmojiImages(const std::string& path, std::vector<std::string>& images) {
+  std::ifstream in{path};
+  if (!in) {
+    std::cerr << "cannot read " << path << std::endl;
+    return false;
+  }
+
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty()) {
+      images.push_back(line);
+    }
+  }
+
+  return true;
+}
+
+// 32 bit fnv-1a, continued over every page so the pages on disk can be checked against the ones in the binary
+unsigned int hashFile(const std::string& path, unsigned int hash) {
+  std::ifstream in{path, std::ios::binary};
+
+  char c;
+  while (in.get(c)) {
+    hash = (hash ^ (unsigned char)c) * 16777619u;
+  }
+
+  return hash;
+}
+
+void writeEmojiAtlasHpp(std::ostream& out, int pageCount, unsigned int hash) {
+  out << "#pragma once\n";
+  out << "\n";
+  out << "// generated by tools/generate-emoji-atlas.cpp, do not edit\n";
+  out << "\n";
+  out << "// the emoji with id `i` is in page `i / emojiAtlasPageLength` at cell `i % emojiAtlasPageLength` (row-major)\n";
+  out << "constexpr int emojiAtlasPageColumns = " << PAGE_COLUMNS << ";\n";
+  out << "constexpr int emojiAtlasPageRows = " << PAGE_ROWS << ";\n";
+  out << "constexpr int emojiAtlasPageLength = emojiAtlasPageColumns * emojiAtlasPageRows;\n";
+  out << "constexpr int emojiAtlasPageCount = " << pageCount << ";\n";
+  out << "\n";
+  out << "// changes whenever a page changes\n";
+  out << "constexpr unsigned int emojiAtlasHash = " << hash << "u;\n";
+  out << "\n";
+  out << "// pages are at \":/emoji-atlas/<cell size>-<page>.png\"\n";
+  out << "constexpr int emojiAtlasCellSizes[] = {";
+  for (std::size_t i = 0; i < CELL_SIZES.size(); i++) {
+    out << (i == 0 ? "" : ", ") << CELL_SIZES[i];
+  }
+  out << "};\n";
+}
+
+bool writeFile(const std::string& path, const std::string& content) {
+  std::ofstream out{path, std::ios::binary | std::ios::trunc};
+  out << content;
+  if (!out) {
+    std::cerr << "cannot write " << path << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::cerr << "usage: " << argv[0] << " <emoji-images.txt> <output directory>" << std::endl;
+    return 1;
+  }
+
+  // only for the image format plugins, nothing is displayed
+  QCoreApplication app{argc, argv};
+
+  std::string emojiImagesPath = argv[1];
+  std::string outputPath = argv[2];
+
+  std::vector<std::string> images;
+  if (!readEmojiImages(emojiImagesPath, images)) {
+    return 1;
+  }
+
+  int pageLength = PAGE_COLUMNS * PAGE_ROWS;
+  int pageCount = (images.size() + pageLength - 1) / pageLength;
+
+  QDir{}.mkpath(QString::fromStdString(outputPath + "/emoji-atlas"));
+
+  unsigned int hash = 2166136261u;
+
+  std::ostringstream emojiAtlasQrc;
+  emojiAtlasQrc << "<!DOCTYPE RCC>\n<RCC version=\"1.0\">\n  <qresource>\n";
+
+  for (int page = 0; page < pageCount; page++) {
+    // every image is decoded once and scaled down to all cell sizes
+    std::vector<QImage> pageImages;
+    for (int cell = 0; cell < pageLength && page * pageLength + cell < (int)images.size(); cell++) {
+      const std::string& imagePath = images[page * pageLength + cell];
+
+      QImage image{QString::fromStdString(imagePath)};
+      if (image.isNull()) {
+        std::cerr << "cannot read " << imagePath << std::endl;
+        return 1;
+      }
+
+      pageImages.push_back(image);
+    }
+
+    for (int cellSize : CELL_SIZES) {
+      QImage pageImage{PAGE_COLUMNS * cellSize, PAGE_ROWS * cellSize, QImage::Format_ARGB32_Premultiplied};
+      pageImage.fill(Qt::transparent);
+
+      QPainter painter{&pageImage};
+      for (int cell = 0; cell < (int)pageImages.size(); cell++) {
+        QImage image = pageImages[cell].scaled(cellSize, cellSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+        int x = (cell % PAGE_COLUMNS) * cellSize + (cellSize - image.width()) / 2;
+        int y = (cell / PAGE_COLUMNS) * cellSize + (cellSize - image.height()) / 2;
+        painter.drawImage(x, y, image);
+      }
+      painter.end();
+
+      std::string pageName = "emoji-atlas/" + std::to_string(cellSize) + "-" + std::to_string(page) + ".png";
+      if (!pageImage.save(QString::fromStdString(outputPath + "/" + pageName), "PNG")) {
+        std::cerr << "cannot write " << outputPath << "/" << pageName << std::endl;
+        return 1;
+      }
+
+      hash = hashFile(outputPath + "/" + pageName, hash);
+
+      // the pages are already compressed, rcc would only waste time on them
+      emojiAtlasQrc << "    <file compress=\"0\">" << pageName << "</file>\n";
+    }
+  }
+
+  emojiAtlasQrc << "  </qresource>\n</RCC>\n";
+
+  std::ostringstream emojiAtlasHpp;
+  writeEmojiAtlasHpp(emojiAtlasHpp, pageCount, hash);
+
+  bool ok = writeFile(outputPath + "/emoji-atlas.hpp", emojiAtlasHpp.str());
+  ok = writeFile(outputPath + "/emoji-atlas.qrc", emojiAtlasQrc.str()) && ok;
+
+  return ok ? 0 : 1;
+}
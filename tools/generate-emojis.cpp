@@ -0,0 +1,628 @@
+// generates emojis.hpp, emojis.cpp and emoji-images.txt from emoji-test.txt.
+// only emojis with an image in res/72x72 are kept, see the `generate-emojis` command in CMakeLists.txt
+//
+// usage: generate-emojis <emoji-test.txt> <res/72x72 directory> <output directory>
+// emoji-images.txt has the image path of every emoji by id and is packed into atlas pages by generate-emoji-atlas.
+// (no std::filesystem, some of the distributions we build on still ship gcc 7)
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+struct EmojiEntry {
+  std::string name;
+  std::vector<unsigned int> codepoints;
+  std::string str;
+  int version = 0;
+  std::string flags;
+  std::string group;
+};
+
+struct EmojiSubgroupEntry {
+  std::string name;
+  std::string group;
+  std::size_t offset = 0;
+};
+
+const std::vector<std::string> EMOJI_GROUPS = {
+  "SMILEYS_AND_EMOTION",
+  "PEOPLE_AND_BODY",
+  "COMPONENT",
+  "ANIMALS_AND_NATURE",
+  "FOOD_AND_DRINK",
+  "TRAVEL_AND_PLACES",
+  "ACTIVITIES",
+  "OBJECTS",
+  "SYMBOLS",
+  "FLAGS",
+};
+
+std::string trim(const std::string& text) {
+  std::size_t begin = text.find_first_not_of(" \t\r\n");
+  if (begin == std::string::npos) {
+    return "";
+  }
+
+  std::size_t end = text.find_last_not_of(" \t\r\n");
+  return text.substr(begin, end - begin + 1);
+}
+
+void appendUtf8(std::string& result, unsigned int codepoint) {
+  if (codepoint < 0x80) {
+    result += (char)codepoint;
+  } else if (codepoint < 0x800) {
+    result += (char)(0xC0 | (codepoint >> 6));
+    result += (char)(0x80 | (codepoint & 0x3F));
+  } else if (codepoint < 0x10000) {
+    result += (char)(0xE0 | (codepoint >> 12));
+    result += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    result += (char)(0x80 | (codepoint & 0x3F));
+  } else {
+    result += (char)(0xF0 | (codepoint >> 18));
+    result += (char)(0x80 | ((codepoint >> 12) & 0x3F));
+    result += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    result += (char)(0x80 | (codepoint & 0x3F));
+  }
+}
+
+// "Smileys & Emotion" -> "SMILEYS_AND_EMOTION"
+std::string toGroupName(const std::string& text) {
+  std::string result;
+
+  for (char c : trim(text)) {
+    if (c == '&') {
+      result += "AND";
+    } else if (c == ' ') {
+      if (result.empty() || result.back() != '_') {
+        result += '_';
+      }
+    } else {
+      result += (char)std::toupper((unsigned char)c);
+    }
+  }
+
+  return result;
+}
+
+// "thumbs up: medium skin tone" -> "thumbs_up_medium_skin_tone"
+std::string toEmojiName(const std::string& text) {
+  std::string lowercase;
+
+  for (std::size_t i = 0; i < text.length(); i++) {
+    unsigned char c = text[i];
+
+    if (c >= 'A' && c <= 'Z') {
+      lowercase += (char)(c - 'A' + 'a');
+      continue;
+    }
+
+    // latin-1 capitals (Å, Ç, É, ...) are encoded as C3 80..9E, except × (C3 97)
+    if (c == 0xC3 && i + 1 < text.length()) {
+      unsigned char next = text[i + 1];
+      if (next >= 0x80 && next <= 0x9E && next != 0x97) {
+        next += 0x20;
+      }
+
+      lowercase += (char)c;
+      lowercase += (char)next;
+      i += 1;
+      continue;
+    }
+
+    // ’ is kept but “ and ” are removed
+    if (text.compare(i, 3, "“") == 0 || text.compare(i, 3, "”") == 0) {
+      i += 2;
+      continue;
+    }
+
+    switch (c) {
+    case '\'':
+    case '.':
+    case ':':
+    case ',':
+    case '(':
+    case ')':
+      continue;
+    case ' ':
+    case '-':
+      lowercase += '_';
+      continue;
+    }
+
+    lowercase += (char)c;
+  }
+
+  // collapse "__" and "___" into a single "_"
+  std::string result;
+  for (std::size_t i = 0; i < lowercase.length(); i++) {
+    if (lowercase.compare(i, 3, "___") == 0) {
+      result += '_';
+      i += 2;
+    } else if (lowercase.compare(i, 2, "__") == 0) {
+      result += '_';
+      i += 1;
+    } else {
+      result += lowercase[i];
+    }
+  }
+
+  return result;
+}
+
+std::string getEmojiFlags(const std::vector<unsigned int>& codepoints) {
+  const std::vector<unsigned int> SKIN_TONES = {0x1F3FB, 0x1F3FC, 0x1F3FD, 0x1F3FE, 0x1F3FF};
+  const std::vector<unsigned int> GENDERS = {0x2642, 0x2640, 0x1F466, 0x1F467, 0x1F468, 0x1F469};
+
+  auto contains = [](const std::vector<unsigned int>& values, unsigned int value) {
+    return std::find(values.begin(), values.end(), value) != values.end();
+  };
+
+  // the modifiers themselves are not a variation
+  auto isVariation = [&](const std::vector<unsigned int>& modifiers) {
+    if (codepoints.size() == 1 && contains(modifiers, codepoints[0])) {
+      return false;
+    }
+
+    return std::any_of(codepoints.begin(), codepoints.end(), [&](unsigned int codepoint) {
+      return contains(modifiers, codepoint);
+    });
+  };
+
+  std::vector<std::string> flags;
+  if (isVariation(SKIN_TONES)) {
+    flags.push_back("Emoji::SKIN_TONE_VARIATION");
+  }
+  if (isVariation(GENDERS)) {
+    flags.push_back("Emoji::GENDER_VARIATION");
+  }
+  if (contains(codepoints, 0x200D)) {
+    flags.push_back("Emoji::ZWJ_SEQUENCE");
+  }
+
+  if (flags.empty()) {
+    return "0";
+  }
+
+  std::string result = flags[0];
+  for (std::size_t i = 1; i < flags.size(); i++) {
+    result += " | " + flags[i];
+  }
+
+  return result;
+}
+
+std::string getImageName(const std::vector<unsigned int>& codepoints) {
+  std::string result;
+
+  for (unsigned int codepoint : codepoints) {
+    char hex[16];
+    std::snprintf(hex, sizeof(hex), result.empty() ? "%x" : "-%x", codepoint);
+    result += hex;
+  }
+
+  return result + ".png";
+}
+
+std::string toCppString(const std::vector<unsigned int>& codepoints) {
+  std::string result;
+
+  for (unsigned int codepoint : codepoints) {
+    char escaped[16];
+    std::snprintf(escaped, sizeof(escaped), "\\U%08X", codepoint);
+    result += escaped;
+  }
+
+  return result;
+}
+
+bool fileExists(const std::string& path) {
+  struct stat info;
+  return stat(path.data(), &info) == 0;
+}
+
+bool parseEmojiTest(const std::string& emojiTestPath, const std::string& imagesPath, std::vector<EmojiEntry>& emojis, std::vector<EmojiSubgroupEntry>& subgroups) {
+  std::ifstream emojiTest{emojiTestPath};
+  if (!emojiTest) {
+    std::cerr << "cannot read " << emojiTestPath << std::endl;
+    return false;
+  }
+
+  std::string group;
+  std::string line;
+  while (std::getline(emojiTest, line)) {
+    if (line.rfind("# group:", 0) == 0) {
+      group = toGroupName(line.substr(8));
+      continue;
+    }
+
+    if (line.rfind("# subgroup:", 0) == 0) {
+      subgroups.push_back({trim(line.substr(11)), group, emojis.size()});
+      continue;
+    }
+
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    // 1F44D 1F3FD ; fully-qualified # 👍🏽 E1.0 thumbs up: medium skin tone
+    std::size_t semicolon = line.find(';');
+    std::size_t hash = line.find('#', semicolon);
+    if (semicolon == std::string::npos || hash == std::string::npos) {
+      continue;
+    }
+
+    std::string status = trim(line.substr(semicolon + 1, hash - semicolon - 1));
+    if (status != "fully-qualified" && status != "unqualified") {
+      continue;
+    }
+
+    EmojiEntry emoji;
+    emoji.group = group;
+
+    std::istringstream codepoints{line.substr(0, semicolon)};
+    std::string codepoint;
+    while (codepoints >> codepoint) {
+      emoji.codepoints.push_back(std::stoul(codepoint, nullptr, 16));
+      appendUtf8(emoji.str, emoji.codepoints.back());
+    }
+
+    if (!fileExists(imagesPath + "/" + getImageName(emoji.codepoints))) {
+      continue;
+    }
+
+    // the emoji itself, its version and its name
+    std::string comment = trim(line.substr(hash + 1));
+    std::size_t nameBegin = comment.find(' ');
+    comment = trim(comment.substr(nameBegin));
+    if (comment.size() > 1 && comment[0] == 'E' && std::isdigit((unsigned char)comment[1])) {
+      std::size_t versionEnd = comment.find(' ');
+      emoji.version = (int)std::stod(comment.substr(1, versionEnd - 1));
+      comment = trim(comment.substr(versionEnd));
+    }
+
+    emoji.name = toEmojiName(comment);
+    emoji.flags = getEmojiFlags(emoji.codepoints);
+
+    emojis.push_back(emoji);
+  }
+
+  // drop subgroups without a single image
+  subgroups.erase(std::remove_if(subgroups.begin(), subgroups.end(), [&](const EmojiSubgroupEntry& subgroup) {
+    auto next = std::find_if(subgroups.begin(), subgroups.end(), [&](const EmojiSubgroupEntry& other) {
+      return other.offset > subgroup.offset;
+    });
+    std::size_t end = next == subgroups.end() ? emojis.size() : next->offset;
+
+    return subgroup.offset == end;
+  }), subgroups.end());
+
+  return true;
+}
+
+// must be the same as `hashEmojiCode` in the generated emojis.cpp (32 bit fnv-1a over the utf8 bytes)
+unsigned int hashEmojiCode(const std::string& code, unsigned int seed) {
+  unsigned int hash = 2166136261u ^ seed;
+  for (char c : code) {
+    hash = (hash ^ (unsigned char)c) * 16777619u;
+  }
+  return hash;
+}
+
+// minimal perfect hash (hash and displace): every bucket gets the first seed that moves all its codes into free slots
+bool createEmojiHash(const std::vector<EmojiEntry>& emojis, std::vector<unsigned int>& seeds, std::vector<int>& ids) {
+  std::size_t bucketCount = (emojis.size() + 3) / 4;
+
+  std::vector<std::vector<int>> buckets(bucketCount);
+  for (std::size_t id = 0; id < emojis.size(); id++) {
+    buckets[hashEmojiCode(emojis[id].str, 0) % bucketCount].push_back(id);
+  }
+
+  seeds.assign(bucketCount, 0);
+  ids.assign(emojis.size(), -1);
+
+  std::vector<std::size_t> bucketsBySize(bucketCount);
+  for (std::size_t bucket = 0; bucket < bucketCount; bucket++) {
+    bucketsBySize[bucket] = bucket;
+  }
+  std::stable_sort(bucketsBySize.begin(), bucketsBySize.end(), [&buckets](std::size_t a, std::size_t b) {
+    return buckets[a].size() > buckets[b].size();
+  });
+
+  for (std::size_t bucket : bucketsBySize) {
+    if (buckets[bucket].empty()) {
+      break;
+    }
+
+    for (unsigned int seed = 1;; seed++) {
+      if (seed > 0xFFFF) {
+        std::cerr << "no seed found for bucket " << bucket << std::endl;
+        return false;
+      }
+
+      std::vector<std::size_t> slots;
+      bool isFree = true;
+      for (int id : buckets[bucket]) {
+        std::size_t slot = hashEmojiCode(emojis[id].str, seed) % emojis.size();
+        if (ids[slot] != -1 || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+          isFree = false;
+          break;
+        }
+        slots.push_back(slot);
+      }
+
+      if (!isFree) {
+        continue;
+      }
+
+      for (std::size_t i = 0; i < slots.size(); i++) {
+        ids[slots[i]] = buckets[bucket][i];
+      }
+      seeds[bucket] = seed;
+      break;
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+void writeCppArray(std::ostream& out, const std::vector<T>& values) {
+  for (std::size_t i = 0; i < values.size(); i++) {
+    if (i == 0) {
+      out << "  ";
+    } else if (i % 16 == 0) {
+      out << ",\n  ";
+    } else {
+      out << ", ";
+    }
+
+    out << values[i];
+  }
+  out << "\n";
+}
+
+void writeEmojisHpp(std::ostream& out, const std::string& source, const std::vector<EmojiEntry>& emojis, const std::vector<EmojiSubgroupEntry>& subgroups) {
+  out << R"(#pragma once
+
+#include <locale>
+#include <string>
+#include <string_view>
+
+// the groups of emoji-test.txt in the same order
+enum class EmojiGroup : unsigned char {
+)";
+  for (const std::string& group : EMOJI_GROUPS) {
+    out << "  " << group << ",\n";
+  }
+  out << R"(};
+
+// a plain view so the whole table is constant initialized and lives in read-only memory.
+// `name` and `code` always point to string literals (or other static storage) and are null terminated
+struct Emoji {
+public:
+  // precomputed by the generator so filtering never has to look at `code`
+  enum Flag : unsigned char {
+    SKIN_TONE_VARIATION = 1 << 0,
+    GENDER_VARIATION = 1 << 1,
+    ZWJ_SEQUENCE = 1 << 2,
+  };
+
+  std::string_view name;
+  std::string_view code;
+  signed char version = -1;
+  unsigned char flags = 0;
+  EmojiGroup group = EmojiGroup::SMILEYS_AND_EMOTION;
+
+  std::string nameByLocale(const std::string& localeKey = std::locale("").name().substr(0, 2)) const;
+
+  bool isGenderVariation() const;
+
+  bool isSkinToneVariation() const;
+
+  bool operator==(const Emoji& other) const;
+
+  operator bool() const;
+
+private:
+  template <int LOCALE_ID>
+  std::string nameByLocaleId() const;
+
+  static constexpr unsigned int hashLocaleKey(const char* s, int off = 0) {
+    return !s[off] ? 5381 : (hashLocaleKey(s, off + 1) * 33) ^ s[off];
+  }
+};
+
+// the emojis of a subgroup are `emojis[offset]` up to the offset of the next subgroup
+struct EmojiSubgroup {
+  std::string_view name;
+  EmojiGroup group;
+  unsigned short offset;
+};
+
+// generated from )" << source << R"(
+extern const Emoji emojis[)" << emojis.size() << R"(];
+
+// the first emoji of every group (index into `emojis`), the last entry is the length of `emojis`
+extern const unsigned short emojiGroupOffsets[)" << EMOJI_GROUPS.size() + 1 << R"(];
+
+extern const EmojiSubgroup emojiSubgroups[)" << subgroups.size() << R"(];
+
+// returns the index into `emojis` of the emoji with exactly this code or -1
+int emojiIdByCode(std::string_view code);
+)";
+}
+
+void writeEmojisCpp(std::ostream& out, const std::vector<EmojiEntry>& emojis, const std::vector<EmojiSubgroupEntry>& subgroups, const std::vector<unsigned int>& seeds, const std::vector<int>& ids) {
+  out << R"(#include "emojis.hpp"
+
+std::string Emoji::nameByLocale(const std::string& localeKey) const {
+  // NO CLDR
+
+  return std::string{name};
+}
+
+bool Emoji::isGenderVariation() const {
+  return (flags & GENDER_VARIATION) != 0;
+}
+
+bool Emoji::isSkinToneVariation() const {
+  return (flags & SKIN_TONE_VARIATION) != 0;
+}
+
+bool Emoji::operator==(const Emoji& other) const {
+  return code == other.code;
+}
+
+Emoji::operator bool() const {
+  return code != "";
+}
+
+constexpr Emoji emojis[] = {
+)";
+  for (std::size_t i = 0; i < emojis.size(); i++) {
+    const EmojiEntry& emoji = emojis[i];
+    out << "  {\"" << emoji.name << "\", \"" << toCppString(emoji.codepoints) << "\", " << emoji.version << ", " << emoji.flags << ", EmojiGroup::" << emoji.group << "}";
+    out << (i + 1 < emojis.size() ? ",\n" : "\n");
+  }
+  out << "};\n";
+
+  std::vector<std::size_t> groupOffsets;
+  for (const std::string& group : EMOJI_GROUPS) {
+    auto first = std::find_if(emojis.begin(), emojis.end(), [&group](const EmojiEntry& emoji) {
+      return emoji.group == group;
+    });
+
+    // empty groups start where the next one does
+    if (first == emojis.end()) {
+      groupOffsets.push_back(-1);
+    } else {
+      groupOffsets.push_back(first - emojis.begin());
+    }
+  }
+  groupOffsets.push_back(emojis.size());
+  for (std::size_t i = groupOffsets.size() - 1; i-- > 0;) {
+    if (groupOffsets[i] == (std::size_t)-1) {
+      groupOffsets[i] = groupOffsets[i + 1];
+    }
+  }
+
+  out << "\nconstexpr unsigned short emojiGroupOffsets[] = {\n";
+  writeCppArray(out, groupOffsets);
+  out << "};\n";
+
+  out << "\nconstexpr EmojiSubgroup emojiSubgroups[] = {\n";
+  for (std::size_t i = 0; i < subgroups.size(); i++) {
+    const EmojiSubgroupEntry& subgroup = subgroups[i];
+    out << "  {\"" << subgroup.name << "\", EmojiGroup::" << subgroup.group << ", " << subgroup.offset << "}";
+    out << (i + 1 < subgroups.size() ? ",\n" : "\n");
+  }
+  out << "};\n";
+
+  out << R"(
+constexpr unsigned int hashEmojiCode(std::string_view code, unsigned int seed) {
+  unsigned int hash = 2166136261u ^ seed;
+  for (char c : code) {
+    hash = (hash ^ (unsigned char)c) * 16777619u;
+  }
+  return hash;
+}
+
+// minimal perfect hash over the codes of `emojis`: the seed of a bucket moves all of its codes into unique slots
+constexpr unsigned short emojiHashSeeds[] = {
+)";
+  writeCppArray(out, seeds);
+  out << R"(};
+
+constexpr unsigned short emojiHashIds[] = {
+)";
+  writeCppArray(out, ids);
+  out << R"(};
+
+int emojiIdByCode(std::string_view code) {
+  unsigned int bucket = hashEmojiCode(code, 0) % (sizeof(emojiHashSeeds) / sizeof(unsigned short));
+  unsigned int slot = hashEmojiCode(code, emojiHashSeeds[bucket]) % (sizeof(emojiHashIds) / sizeof(unsigned short));
+
+  // every code hashes to some slot, only the one stored there can match
+  int emojiId = emojiHashIds[slot];
+  if (emojis[emojiId].code != code) {
+    return -1;
+  }
+
+  return emojiId;
+}
+)";
+}
+
+void writeEmojiImages(std::ostream& out, const std::string& imagesPath, const std::vector<EmojiEntry>& emojis) {
+  for (const EmojiEntry& emoji : emojis) {
+    out << imagesPath << "/" << getImageName(emoji.codepoints) << "\n";
+  }
+}
+
+bool writeFile(const std::string& path, const std::string& content) {
+  std::ofstream out{path, std::ios::binary | std::ios::trunc};
+  out << content;
+  if (!out) {
+    std::cerr << "cannot write " << path << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    std::cerr << "usage: " << argv[0] << " <emoji-test.txt> <res/72x72 directory> <output directory>" << std::endl;
+    return 1;
+  }
+
+  std::string emojiTestPath = argv[1];
+  std::string imagesPath = argv[2];
+  std::string outputPath = argv[3];
+
+  std::vector<EmojiEntry> emojis;
+  std::vector<EmojiSubgroupEntry> subgroups;
+  if (!parseEmojiTest(emojiTestPath, imagesPath, emojis, subgroups)) {
+    return 1;
+  }
+
+  std::vector<unsigned int> seeds;
+  std::vector<int> ids;
+  if (!createEmojiHash(emojis, seeds, ids)) {
+    return 1;
+  }
+
+  // the version line of emoji-test.txt names the source
+  std::string source = emojiTestPath.substr(emojiTestPath.rfind('/') + 1);
+  {
+    std::ifstream emojiTest{emojiTestPath};
+    std::string line;
+    while (std::getline(emojiTest, line) && line.rfind("#", 0) == 0) {
+      if (line.rfind("# Version:", 0) == 0) {
+        source = "https://unicode.org/Public/emoji/" + trim(line.substr(10)) + "/emoji-test.txt";
+        break;
+      }
+    }
+  }
+
+  std::ostringstream emojisHpp;
+  writeEmojisHpp(emojisHpp, source, emojis, subgroups);
+
+  std::ostringstream emojisCpp;
+  writeEmojisCpp(emojisCpp, emojis, subgroups, seeds, ids);
+
+  std::ostringstream emojiImages;
+  writeEmojiImages(emojiImages, imagesPath, emojis);
+
+  bool ok = writeFile(outputPath + "/emojis.hpp", emojisHpp.str());
+  ok = writeFile(outputPath + "/emojis.cpp", emojisCpp.str()) && ok;
+  ok = writeFile(outputPath + "/emoji-images.txt", emojiImages.str()) && ok;
+
+  return ok ? 0 : 1;
+}